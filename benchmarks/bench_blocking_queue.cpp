@@ -0,0 +1,90 @@
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/blocking_queue.h"
+
+using DataStructures::BlockingQueue;
+
+/*
+ * Ping-pong between two threads over a pair of queues. Half of each round
+ * trip is one handoff, i.e. the time from a push in one thread until the
+ * pop returns in the other, including the wakeup of a sleeping consumer.
+ */
+void bench_handoff_latency(int rounds)
+{
+	BlockingQueue<int64_t> ping(1);
+	BlockingQueue<int64_t> pong(1);
+	std::thread echo([&] {
+		int64_t v;
+		while (ping.pop(v)) {
+			pong.push(v);
+		}
+	});
+	std::vector<int64_t> samples;
+	samples.reserve(static_cast<size_t>(rounds));
+	for (int i = 0; i < rounds; i++) {
+		int64_t t0 = Bench::now_ns();
+		ping.push(t0);
+		int64_t v;
+		pong.pop(v);
+		samples.push_back((Bench::now_ns() - t0) / 2);
+	}
+	ping.close();
+	echo.join();
+	Bench::report("handoff latency p50",
+		      double(Bench::percentile(samples, 50)), "ns");
+	Bench::report("handoff latency p99",
+		      double(Bench::percentile(samples, 99)), "ns");
+	Bench::report("handoff latency p99.9",
+		      double(Bench::percentile(samples, 99.9)), "ns");
+}
+
+/*
+ * Producers stream elements to consumers through one bounded queue.
+ */
+void bench_throughput(int producers, int consumers, size_t capacity,
+		      int per_producer)
+{
+	BlockingQueue<int> q(capacity);
+	std::vector<std::thread> threads;
+	int64_t t0 = Bench::now_ns();
+	for (int c = 0; c < consumers; c++) {
+		threads.emplace_back([&] {
+			int v;
+			while (q.pop(v)) {
+				Bench::do_not_optimize(v);
+			}
+		});
+	}
+	std::vector<std::thread> writers;
+	for (int p = 0; p < producers; p++) {
+		writers.emplace_back([&] {
+			for (int i = 0; i < per_producer; i++) {
+				q.push(i);
+			}
+		});
+	}
+	for (std::thread& t : writers) {
+		t.join();
+	}
+	q.close();
+	for (std::thread& t : threads) {
+		t.join();
+	}
+	double secs = double(Bench::now_ns() - t0) / 1e9;
+	char name[64];
+	std::snprintf(name, sizeof(name), "throughput %dP/%dC cap %zu",
+		      producers, consumers, capacity);
+	Bench::report(name, double(producers) * per_producer / secs / 1e6,
+		      "Mops/s");
+}
+
+int main()
+{
+	bench_handoff_latency(100000);
+	bench_throughput(1, 1, 1024, 1000000);
+	bench_throughput(4, 4, 1024, 250000);
+	bench_throughput(4, 4, 16, 250000);
+	return 0;
+}
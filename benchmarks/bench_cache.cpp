@@ -0,0 +1,119 @@
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <list>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/lfu_cache.h"
+#include "data_structures/lru_cache.h"
+
+/*
+ * Every cache serves the same trace of keys drawn from a Zipfian
+ * distribution with exponent 0.99 over one million keys. A lookup that
+ * misses is followed by inserting the key, as a read-through cache would.
+ * The baseline is the usual LRU cache made of std::list and
+ * std::unordered_map.
+ */
+class StdLRUCache {
+public:
+	explicit StdLRUCache(size_t capacity) : cap(capacity) {}
+
+	bool get(int key, int& value)
+	{
+		auto it = map.find(key);
+		if (it == map.end()) {
+			return false;
+		}
+		order.splice(order.begin(), order, it->second);
+		value = it->second->second;
+		return true;
+	}
+
+	void put(int key, int value)
+	{
+		auto it = map.find(key);
+		if (it != map.end()) {
+			it->second->second = value;
+			order.splice(order.begin(), order, it->second);
+			return;
+		}
+		order.emplace_front(key, value);
+		map[key] = order.begin();
+		if (map.size() > cap) {
+			map.erase(order.back().first);
+			order.pop_back();
+		}
+	}
+
+private:
+	size_t cap;
+	std::list<std::pair<int, int>> order;
+	std::unordered_map<int, std::list<std::pair<int, int>>::iterator> map;
+};
+
+std::vector<int> zipf_trace(size_t keys, double s, size_t n)
+{
+	std::vector<double> cdf(keys);
+	double sum = 0;
+	for (size_t i = 0; i < keys; i++) {
+		sum += 1.0 / std::pow(double(i + 1), s);
+		cdf[i] = sum;
+	}
+	std::mt19937_64 rng(42);
+	std::uniform_real_distribution<double> u(0, sum);
+	// Scatter the ranks over the key space, so that popular keys are not
+	// also neighbouring integers.
+	std::vector<int> perm(keys);
+	for (size_t i = 0; i < keys; i++) {
+		perm[i] = int(i);
+	}
+	std::shuffle(perm.begin(), perm.end(), rng);
+	std::vector<int> trace(n);
+	for (size_t i = 0; i < n; i++) {
+		size_t rank = size_t(std::lower_bound(cdf.begin(), cdf.end(),
+						      u(rng)) -
+				     cdf.begin());
+		trace[i] = perm[std::min(rank, keys - 1)];
+	}
+	return trace;
+}
+
+template <typename Cache>
+void bench(const char* label, size_t capacity, const std::vector<int>& trace)
+{
+	Cache cache(capacity);
+	size_t hits = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int key : trace) {
+		int v = 0;
+		if (cache.get(key, v)) {
+			hits++;
+		} else {
+			cache.put(key, key);
+		}
+		Bench::do_not_optimize(v);
+	}
+	int64_t t1 = Bench::now_ns();
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s time cap=%zu", label, capacity);
+	Bench::report(name, double(t1 - t0) / double(trace.size()), "ns/op");
+	std::snprintf(name, sizeof(name), "%s hit ratio cap=%zu", label,
+		      capacity);
+	Bench::report(name, 100.0 * double(hits) / double(trace.size()), "%");
+}
+
+int main()
+{
+	std::vector<int> trace = zipf_trace(1000000, 0.99, 5000000);
+	for (size_t capacity : {size_t(1000), size_t(100000)}) {
+		bench<StdLRUCache>("std::list LRU", capacity, trace);
+		bench<DataStructures::LRUCache<int, int>>("LRUCache", capacity,
+							  trace);
+		bench<DataStructures::LFUCache<int, int>>("LFUCache", capacity,
+							  trace);
+	}
+	return 0;
+}
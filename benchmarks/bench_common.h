@@ -0,0 +1,59 @@
+#ifndef DATA_STRUCTURES_BENCH_COMMON_H
+#define DATA_STRUCTURES_BENCH_COMMON_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+namespace Bench {
+
+/** @brief Monotonic timestamp in nanoseconds. */
+inline int64_t now_ns()
+{
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+		       std::chrono::steady_clock::now().time_since_epoch())
+		.count();
+}
+
+/**
+ * @brief Keep the optimizer from discarding a computed value.
+ * @param value The value that must be considered used.
+ */
+template <typename T>
+inline void do_not_optimize(const T& value)
+{
+	asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Get a percentile of a set of samples.
+ * @param samples The samples, reordered in place.
+ * @param p The percentile in [0, 100].
+ * @return The sample at the requested percentile.
+ */
+inline int64_t percentile(std::vector<int64_t>& samples, double p)
+{
+	if (samples.empty()) {
+		return 0;
+	}
+	size_t k = static_cast<size_t>(p / 100.0 *
+				       static_cast<double>(samples.size() - 1));
+	std::nth_element(samples.begin(),
+			 samples.begin() + static_cast<std::ptrdiff_t>(k),
+			 samples.end());
+	return samples[k];
+}
+
+/**
+ * @brief Print one result row as "name: value unit".
+ */
+inline void report(const char* name, double value, const char* unit)
+{
+	std::printf("%-48s %12.2f %s\n", name, value, unit);
+}
+
+} // namespace Bench
+
+#endif // DATA_STRUCTURES_BENCH_COMMON_H
@@ -0,0 +1,76 @@
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/compact_linked_list.h"
+#include "data_structures/doubly_linked_list.h"
+
+/*
+ * Both lists are built by inserting at random positions, so that list
+ * order and allocation order differ, and then churned by deleting and
+ * re-adding elements at the ends. Reported are the bytes held per element
+ * and the time of a full traversal through the iterators.
+ */
+void report(const char* label, const char* what, int n, double value,
+	    const char* unit)
+{
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s %s n=%d", label, what, n);
+	Bench::report(name, value, unit);
+}
+
+template <typename List>
+void build(List& list, int n)
+{
+	std::srand(3);
+	for (int i = 0; i < n; i++) {
+		int pos = i < 64 ? 0 : std::rand() % 64;
+		list.add(pos, i);
+	}
+	for (int i = 0; i < n / 2; i++) {
+		list.add_last(list.del_first());
+	}
+}
+
+size_t bytes_held(DataStructures::CompactLinkedList<int>& list)
+{
+	return list.get_capacity() * (sizeof(int) + 2 * sizeof(uint32_t));
+}
+
+size_t bytes_held(DataStructures::DoublyLinkedList<int>& list)
+{
+	return list.get_pool()->blocks_reserved() *
+	       list.get_pool()->block_size();
+}
+
+template <typename List>
+void bench(const char* label, int n, int rounds)
+{
+	List list;
+	build(list, n);
+	report(label, "memory", n, double(bytes_held(list)) / n, "B/elem");
+
+	long sum = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int r = 0; r < rounds; r++) {
+		for (int v : list) {
+			sum += v;
+		}
+		Bench::do_not_optimize(sum);
+	}
+	int64_t t1 = Bench::now_ns();
+	report(label, "traversal", n, double(t1 - t0) / rounds / n,
+	       "ns/elem");
+}
+
+int main()
+{
+	for (int n : {1000, 100000, 1000000}) {
+		int rounds = 10000000 / n;
+		bench<DataStructures::CompactLinkedList<int>>(
+			"CompactLinkedList", n, rounds);
+		bench<DataStructures::DoublyLinkedList<int>>(
+			"DoublyLinkedList", n, rounds);
+	}
+	return 0;
+}
@@ -0,0 +1,119 @@
+#include <cstdio>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/concurrent_sorted_list.h"
+#include "data_structures/singly_linked_list.h"
+
+/*
+ * The set starts with half of the keys in [0, 512) and every thread runs
+ * a random mix of lookups, adds and removes on uniformly drawn keys, so
+ * the size stays around 256. The baseline guards a sorted
+ * SinglyLinkedList with one mutex. Reported are the operations per second
+ * over all threads.
+ */
+struct LockedSortedList {
+	std::mutex mtx;
+	DataStructures::SinglyLinkedList<int> list;
+
+	typename DataStructures::SinglyLinkedList<int>::Cursor seek(int key)
+	{
+		typename DataStructures::SinglyLinkedList<int>::Cursor c =
+			list.cursor();
+		while (!c.is_end() && c.get() < key) {
+			c.advance();
+		}
+		return c;
+	}
+
+	bool contains(int key)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		typename DataStructures::SinglyLinkedList<int>::Cursor c =
+			seek(key);
+		return !c.is_end() && c.get() == key;
+	}
+
+	bool add(int key)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		typename DataStructures::SinglyLinkedList<int>::Cursor c =
+			seek(key);
+		if (!c.is_end() && c.get() == key) {
+			return false;
+		}
+		c.insert_before(key);
+		return true;
+	}
+
+	bool remove(int key)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		typename DataStructures::SinglyLinkedList<int>::Cursor c =
+			seek(key);
+		if (c.is_end() || c.get() != key) {
+			return false;
+		}
+		c.erase();
+		return true;
+	}
+};
+
+const int key_range = 512;
+
+template <typename Set>
+void bench(const char* label, const char* mix, int read_percent,
+	   int threads, int ops_per_thread)
+{
+	Set set;
+	for (int k = 0; k < key_range; k += 2) {
+		set.add(k);
+	}
+	std::vector<std::thread> workers;
+	int64_t t0 = Bench::now_ns();
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&set, t, read_percent, ops_per_thread] {
+			std::mt19937 rng(unsigned(t + 1));
+			size_t found = 0;
+			for (int i = 0; i < ops_per_thread; i++) {
+				int key = int(rng() % key_range);
+				int op = int(rng() % 100);
+				if (op < read_percent) {
+					found += set.contains(key);
+				} else if ((op - read_percent) % 2 == 0) {
+					found += set.add(key);
+				} else {
+					found += set.remove(key);
+				}
+			}
+			Bench::do_not_optimize(found);
+		});
+	}
+	for (std::thread& w : workers) {
+		w.join();
+	}
+	double secs = double(Bench::now_ns() - t0) / 1e9;
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s %s %d threads", label, mix,
+		      threads);
+	Bench::report(name, double(threads) * ops_per_thread / secs / 1e6,
+		      "Mops/s");
+}
+
+int main()
+{
+	for (int threads = 1; threads <= 32; threads *= 2) {
+		int ops = 400000 / threads;
+		bench<DataStructures::ConcurrentSortedList<int>>(
+			"lazy list", "90% reads", 90, threads, ops);
+		bench<LockedSortedList>("mutex SinglyLinkedList", "90% reads",
+					90, threads, ops);
+		bench<DataStructures::ConcurrentSortedList<int>>(
+			"lazy list", "50% reads", 50, threads, ops);
+		bench<LockedSortedList>("mutex SinglyLinkedList", "50% reads",
+					50, threads, ops);
+	}
+	return 0;
+}
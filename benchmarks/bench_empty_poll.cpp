@@ -0,0 +1,52 @@
+#include <cstdio>
+#include <stdexcept>
+#include "bench_common.h"
+#include "data_structures/queue_with_array.h"
+#include "data_structures/queue_with_linked_list.h"
+
+/*
+ * Polls an empty queue, as an event loop does between events, once by
+ * catching the exception of pop() and once through try_pop().
+ */
+template <typename Queue>
+void bench(const char* name, int rounds)
+{
+	Queue q;
+	char label[64];
+	int out = 0;
+	long misses = 0;
+
+	int64_t t0 = Bench::now_ns();
+	for (int i = 0; i < rounds; i++) {
+		try {
+			out = q.pop();
+		} catch (const std::out_of_range&) {
+			misses++;
+		}
+	}
+	int64_t t1 = Bench::now_ns();
+	Bench::do_not_optimize(misses);
+	std::snprintf(label, sizeof(label), "%s pop() catching", name);
+	Bench::report(label, double(t1 - t0) / rounds, "ns/poll");
+
+	misses = 0;
+	t0 = Bench::now_ns();
+	for (int i = 0; i < rounds; i++) {
+		if (!q.try_pop(out)) {
+			misses++;
+		}
+		Bench::do_not_optimize(out);
+	}
+	t1 = Bench::now_ns();
+	Bench::do_not_optimize(misses);
+	std::snprintf(label, sizeof(label), "%s try_pop()", name);
+	Bench::report(label, double(t1 - t0) / rounds, "ns/poll");
+}
+
+int main()
+{
+	bench<DataStructures::QueueWithArray<int>>("QueueWithArray", 200000);
+	bench<DataStructures::QueueWithLinkedList<int>>("QueueWithLinkedList",
+							200000);
+	return 0;
+}
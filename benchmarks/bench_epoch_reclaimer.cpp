@@ -0,0 +1,116 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/epoch_reclaimer.h"
+#include "data_structures/hazard_pointers.h"
+#include "data_structures/lock_free_stack.h"
+
+typedef DataStructures::EpochReclaimer Epoch;
+
+/*
+ * Cost of entering and leaving a critical section and protecting one
+ * pointer, which every lock-free operation pays at least once.
+ */
+template <typename Reclaimer>
+void bench_guard(const char* label, int iterations)
+{
+	int value = 1;
+	std::atomic<int*> shared(&value);
+	int sum = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int i = 0; i < iterations; i++) {
+		typename Reclaimer::Guard guard;
+		sum += *guard.protect(shared);
+	}
+	int64_t t1 = Bench::now_ns();
+	Bench::do_not_optimize(sum);
+	Bench::report(label, double(t1 - t0) / iterations, "ns/op");
+}
+
+/*
+ * Every thread alternates a push and a pop on one shared stack. Besides
+ * throughput, each thread samples how many retired nodes it holds and the
+ * maxima are summed, an upper bound on the garbage kept at any one time.
+ */
+void bench_stack_ebr(int threads, int pairs_per_thread)
+{
+	DataStructures::LockFreeStack<int, Epoch> stack;
+	std::vector<size_t> held(size_t(threads), 0);
+	std::vector<std::thread> workers;
+	int64_t t0 = Bench::now_ns();
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&stack, &held, t, pairs_per_thread] {
+			int v = 0;
+			size_t most = 0;
+			for (int i = 0; i < pairs_per_thread; i++) {
+				stack.push(i);
+				stack.pop(v);
+				if ((i & 63) == 0) {
+					most = std::max(most, Epoch::pending());
+				}
+			}
+			held[size_t(t)] = most;
+			Bench::do_not_optimize(v);
+		});
+	}
+	for (std::thread& w : workers) {
+		w.join();
+	}
+	double secs = double(Bench::now_ns() - t0) / 1e9;
+	size_t total = 0;
+	for (size_t h : held) {
+		total += h;
+	}
+	char name[64];
+	std::snprintf(name, sizeof(name), "stack + epoch %d threads", threads);
+	Bench::report(name, double(threads) * pairs_per_thread / secs / 1e6,
+		      "Mpairs/s");
+	std::snprintf(name, sizeof(name), "stack + epoch %d threads held",
+		      threads);
+	Bench::report(name, double(total), "nodes");
+}
+
+void bench_stack_hp(int threads, int pairs_per_thread)
+{
+	DataStructures::LockFreeStack<int, DataStructures::HazardPointers>
+		stack;
+	std::vector<std::thread> workers;
+	int64_t t0 = Bench::now_ns();
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&stack, pairs_per_thread] {
+			int v = 0;
+			for (int i = 0; i < pairs_per_thread; i++) {
+				stack.push(i);
+				stack.pop(v);
+			}
+			Bench::do_not_optimize(v);
+		});
+	}
+	for (std::thread& w : workers) {
+		w.join();
+	}
+	double secs = double(Bench::now_ns() - t0) / 1e9;
+	char name[64];
+	std::snprintf(name, sizeof(name), "stack + hazard %d threads",
+		      threads);
+	Bench::report(name, double(threads) * pairs_per_thread / secs / 1e6,
+		      "Mpairs/s");
+}
+
+int main()
+{
+	bench_guard<DataStructures::HazardPointers>("hazard guard + protect",
+						    10000000);
+	bench_guard<Epoch>("epoch guard + protect",
+						    10000000);
+	unsigned hw = std::thread::hardware_concurrency();
+	int max_threads = hw > 0 ? int(hw) : 1;
+	for (int threads = 1; threads <= 2 * max_threads; threads *= 2) {
+		bench_stack_hp(threads, 500000);
+		bench_stack_ebr(threads, 500000);
+	}
+	return 0;
+}
@@ -0,0 +1,72 @@
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/doubly_linked_list.h"
+
+/*
+ * A random permutation is appended to the list, which then gets sorted.
+ * Sorting relinks the nodes without moving them, so the list order ends
+ * up unrelated to the address order, as after long churn. A traversal is
+ * timed on that fragmented list, after compact(), and over the array
+ * returned by freeze().
+ */
+void report(const char* what, int n, double value, const char* unit)
+{
+	char name[64];
+	std::snprintf(name, sizeof(name), "DoublyLinkedList %s n=%d", what, n);
+	Bench::report(name, value, unit);
+}
+
+template <typename Range>
+double traverse_ns(const Range& range, int n, int rounds)
+{
+	long sum = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int r = 0; r < rounds; r++) {
+		for (int v : range) {
+			sum += v;
+		}
+		Bench::do_not_optimize(sum);
+	}
+	int64_t t1 = Bench::now_ns();
+	return double(t1 - t0) / rounds / n;
+}
+
+void bench(int n, int rounds)
+{
+	std::vector<int> perm(static_cast<size_t>(n));
+	for (int i = 0; i < n; i++) {
+		perm[size_t(i)] = i;
+	}
+	std::shuffle(perm.begin(), perm.end(), std::mt19937(7));
+	DataStructures::DoublyLinkedList<int> list;
+	for (int v : perm) {
+		list.add_last(v);
+	}
+	list.sort();
+	report("fragmented traversal", n, traverse_ns(list, n, rounds),
+	       "ns/elem");
+
+	int64_t t0 = Bench::now_ns();
+	list.compact();
+	int64_t t1 = Bench::now_ns();
+	report("compact()", n, double(t1 - t0) / n, "ns/elem");
+	report("compacted traversal", n, traverse_ns(list, n, rounds),
+	       "ns/elem");
+
+	t0 = Bench::now_ns();
+	std::vector<int> flat = list.freeze();
+	t1 = Bench::now_ns();
+	report("freeze()", n, double(t1 - t0) / n, "ns/elem");
+	report("frozen scan", n, traverse_ns(flat, n, rounds), "ns/elem");
+}
+
+int main()
+{
+	for (int n : {10000, 1000000, 4000000}) {
+		bench(n, std::max(1, 20000000 / n));
+	}
+	return 0;
+}
@@ -0,0 +1,111 @@
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/lock_free_queue.h"
+#include "data_structures/queue_with_linked_list.h"
+
+/* Count every allocation to show the steady state of the node cache. */
+static std::atomic<long> allocations(0);
+
+void* operator new(size_t n)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	void* p = std::malloc(n);
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+struct LockedQueue {
+	std::mutex mtx;
+	DataStructures::QueueWithLinkedList<int> q;
+
+	void push(int v)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		q.push(v);
+	}
+
+	bool pop(int& out)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		if (q.size() == 0) {
+			return false;
+		}
+		out = q.pop();
+		return true;
+	}
+};
+
+/*
+ * Producers and consumers move a fixed number of elements through one
+ * shared queue. Reported is the throughput and the number of allocations
+ * per element after a warm-up round.
+ */
+template <typename Queue>
+void bench(const char* label, int producers, int consumers, int per_producer)
+{
+	Queue q;
+	for (int i = 0; i < 4096; i++) {
+		q.push(i);
+	}
+	int v;
+	while (q.pop(v)) {
+	}
+	long total = long(producers) * per_producer;
+	std::atomic<long> popped(0);
+	long allocs0 = allocations.load();
+	int64_t t0 = Bench::now_ns();
+	std::vector<std::thread> threads;
+	for (int c = 0; c < consumers; c++) {
+		threads.emplace_back([&] {
+			int x;
+			while (popped.load(std::memory_order_relaxed) < total) {
+				if (q.pop(x)) {
+					popped.fetch_add(1);
+				}
+			}
+		});
+	}
+	for (int p = 0; p < producers; p++) {
+		threads.emplace_back([&] {
+			for (int i = 0; i < per_producer; i++) {
+				q.push(i);
+			}
+		});
+	}
+	for (std::thread& t : threads) {
+		t.join();
+	}
+	double secs = double(Bench::now_ns() - t0) / 1e9;
+	double allocs = double(allocations.load() - allocs0);
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s %dP/%dC", label, producers,
+		      consumers);
+	Bench::report(name, double(total) / secs / 1e6, "Mops/s");
+	std::snprintf(name, sizeof(name), "%s %dP/%dC allocations", label,
+		      producers, consumers);
+	Bench::report(name, allocs / double(total), "per element");
+}
+
+int main()
+{
+	int configs[][2] = {{1, 1}, {2, 2}, {4, 4}, {8, 8}};
+	for (int* pc : configs) {
+		bench<DataStructures::LockFreeQueue<int>>(
+			"michael-scott", pc[0], pc[1], 200000);
+		bench<LockedQueue>("mutex QueueWithLinkedList", pc[0], pc[1],
+				   200000);
+	}
+	return 0;
+}
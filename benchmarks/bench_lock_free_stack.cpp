@@ -0,0 +1,75 @@
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/lock_free_stack.h"
+#include "data_structures/stack_with_linked_list.h"
+
+/*
+ * Every thread alternates a push and a pop on one shared stack, which is
+ * the free-list pattern. Reported is the number of push/pop pairs per
+ * second over all threads.
+ */
+struct LockedStack {
+	std::mutex mtx;
+	DataStructures::StackWithLinkedList<int> stack;
+
+	void push(int v)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		stack.push(v);
+	}
+
+	bool pop(int& out)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		if (stack.size() == 0) {
+			return false;
+		}
+		out = stack.pop();
+		return true;
+	}
+};
+
+template <typename Stack>
+void bench(const char* label, int threads, int pairs_per_thread)
+{
+	Stack stack;
+	for (int i = 0; i < 1024; i++) {
+		stack.push(i);
+	}
+	std::vector<std::thread> workers;
+	int64_t t0 = Bench::now_ns();
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&stack, pairs_per_thread] {
+			int v = 0;
+			for (int i = 0; i < pairs_per_thread; i++) {
+				stack.push(i);
+				stack.pop(v);
+			}
+			Bench::do_not_optimize(v);
+		});
+	}
+	for (std::thread& w : workers) {
+		w.join();
+	}
+	double secs = double(Bench::now_ns() - t0) / 1e9;
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s %d threads", label, threads);
+	Bench::report(name, double(threads) * pairs_per_thread / secs / 1e6,
+		      "Mpairs/s");
+}
+
+int main()
+{
+	unsigned hw = std::thread::hardware_concurrency();
+	int max_threads = hw > 0 ? int(hw) : 1;
+	for (int threads = 1; threads <= 2 * max_threads; threads *= 2) {
+		bench<DataStructures::LockFreeStack<int>>("treiber + hazard",
+							  threads, 500000);
+		bench<LockedStack>("mutex StackWithLinkedList", threads,
+				   500000);
+	}
+	return 0;
+}
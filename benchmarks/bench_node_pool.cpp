@@ -0,0 +1,101 @@
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <new>
+#include "bench_common.h"
+#include "data_structures/doubly_linked_list.h"
+#include "data_structures/singly_linked_list.h"
+
+/* Count every allocation to compare the pooled lists with std::list. */
+static std::atomic<long> allocations(0);
+
+void* operator new(size_t n)
+{
+	allocations.fetch_add(1, std::memory_order_relaxed);
+	void* p = std::malloc(n);
+	if (p == nullptr) {
+		throw std::bad_alloc();
+	}
+	return p;
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+/* Uniform interface over the lists, used as a FIFO. */
+struct StdList {
+	std::list<long> list;
+
+	void add_last(long v) { list.push_back(v); }
+
+	long del_first()
+	{
+		long v = list.front();
+		list.pop_front();
+		return v;
+	}
+
+	void clear() { list.clear(); }
+};
+
+void report(const char* label, const char* what, int64_t ns, long allocs,
+	    long ops)
+{
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s %s", label, what);
+	Bench::report(name, double(ns) / double(ops), "ns/op");
+	std::snprintf(name, sizeof(name), "%s %s allocations", label, what);
+	Bench::report(name, double(allocs) / double(ops), "per op");
+}
+
+/*
+ * Queue churn keeps a fixed number of elements while one is appended and
+ * one removed per operation; build and clear fills the list and empties it
+ * at once, which the pool does by freeing its slabs.
+ */
+template <typename List>
+void bench(const char* label, long depth, long ops)
+{
+	List list;
+	for (long i = 0; i < depth; i++) {
+		list.add_last(i);
+	}
+	long sum = 0;
+	long a0 = allocations.load();
+	int64_t t0 = Bench::now_ns();
+	for (long i = 0; i < ops; i++) {
+		list.add_last(i);
+		sum += list.del_first();
+	}
+	int64_t t1 = Bench::now_ns();
+	report(label, "churn", t1 - t0, allocations.load() - a0, ops);
+
+	a0 = allocations.load();
+	t0 = Bench::now_ns();
+	for (long round = 0; round < ops / depth; round++) {
+		list.clear();
+		for (long i = 0; i < depth; i++) {
+			list.add_last(i);
+		}
+	}
+	t1 = Bench::now_ns();
+	report(label, "build+clear", t1 - t0, allocations.load() - a0,
+	       ops / depth * depth);
+	Bench::do_not_optimize(sum);
+}
+
+int main()
+{
+	const long ops = 4000000;
+	for (long depth : {16L, 1024L, 65536L}) {
+		std::printf("depth %ld\n", depth);
+		bench<DataStructures::SinglyLinkedList<long>>("singly", depth,
+							      ops);
+		bench<DataStructures::DoublyLinkedList<long>>("doubly", depth,
+							      ops);
+		bench<StdList>("std::list", depth, ops);
+	}
+	return 0;
+}
@@ -0,0 +1,99 @@
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include <random>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/priority_queue.h"
+
+/*
+ * For each size, time heapify of n random keys, then n pushes followed by n
+ * pops, reported per element. Once the heap outgrows the caches every level
+ * visited by a sift is a likely miss, so the shallower 4- and 8-ary layouts
+ * are expected to pull ahead of the binary heap at the larger sizes.
+ */
+template <size_t Arity>
+void bench_arity(const std::vector<int>& keys)
+{
+	size_t n = keys.size();
+	int64_t t0 = Bench::now_ns();
+	DataStructures::PriorityQueue<int, std::less<int>, Arity> built(
+		keys.begin(), keys.end());
+	int64_t t1 = Bench::now_ns();
+	Bench::do_not_optimize(built.peek());
+
+	DataStructures::PriorityQueue<int, std::less<int>, Arity> pq;
+	int64_t t2 = Bench::now_ns();
+	for (int k : keys) {
+		pq.push(k);
+	}
+	int64_t t3 = Bench::now_ns();
+	long long sum = 0;
+	while (!pq.is_empty()) {
+		sum += pq.pop();
+	}
+	int64_t t4 = Bench::now_ns();
+	Bench::do_not_optimize(sum);
+
+	char name[64];
+	double dn = double(n);
+	std::snprintf(name, sizeof(name), "n=%zu %zu-ary heapify", n, Arity);
+	Bench::report(name, double(t1 - t0) / dn, "ns/elem");
+	std::snprintf(name, sizeof(name), "n=%zu %zu-ary push", n, Arity);
+	Bench::report(name, double(t3 - t2) / dn, "ns/elem");
+	std::snprintf(name, sizeof(name), "n=%zu %zu-ary pop", n, Arity);
+	Bench::report(name, double(t4 - t3) / dn, "ns/elem");
+}
+
+void bench_std(const std::vector<int>& keys)
+{
+	std::priority_queue<int> pq;
+	int64_t t0 = Bench::now_ns();
+	for (int k : keys) {
+		pq.push(k);
+	}
+	int64_t t1 = Bench::now_ns();
+	long long sum = 0;
+	while (!pq.empty()) {
+		sum += pq.top();
+		pq.pop();
+	}
+	int64_t t2 = Bench::now_ns();
+	Bench::do_not_optimize(sum);
+	char name[64];
+	double dn = double(keys.size());
+	std::snprintf(name, sizeof(name), "n=%zu std::priority_queue push",
+		      keys.size());
+	Bench::report(name, double(t1 - t0) / dn, "ns/elem");
+	std::snprintf(name, sizeof(name), "n=%zu std::priority_queue pop",
+		      keys.size());
+	Bench::report(name, double(t2 - t1) / dn, "ns/elem");
+}
+
+/*
+ * Usage: BenchPriorityQueue [max_exponent]
+ * Sizes run from 10^3 up to 10^max_exponent (default 7, at most 8; 10^8
+ * needs a few GB of memory).
+ */
+int main(int argc, char** argv)
+{
+	int max_exp = argc > 1 ? std::atoi(argv[1]) : 7;
+	if (max_exp < 3 || max_exp > 8) {
+		std::fprintf(stderr, "max_exponent must be in [3, 8]\n");
+		return 1;
+	}
+	std::mt19937 rng(12345);
+	size_t n = 1000;
+	for (int e = 3; e <= max_exp; e++, n *= 10) {
+		std::vector<int> keys(n);
+		for (int& k : keys) {
+			k = int(rng());
+		}
+		bench_arity<2>(keys);
+		bench_arity<4>(keys);
+		bench_arity<8>(keys);
+		bench_std(keys);
+	}
+	return 0;
+}
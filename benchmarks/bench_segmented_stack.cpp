@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/segmented_stack.h"
+#include "data_structures/stack_with_array.h"
+
+/*
+ * Pushes a deep stack, as a depth-first search of a large graph does, and
+ * times every push on its own. The tail of the latency distribution shows
+ * the stalls of the array stack while it copies itself into a twice as
+ * large array, which the segmented stack never does.
+ */
+template <typename Stack>
+void bench_latency(const char* name, int n)
+{
+	std::vector<int64_t> samples(static_cast<size_t>(n));
+	Stack stack;
+	for (int i = 0; i < n; i++) {
+		int64_t t0 = Bench::now_ns();
+		stack.push(i);
+		int64_t t1 = Bench::now_ns();
+		samples[size_t(i)] = t1 - t0;
+	}
+	Bench::do_not_optimize(stack.size());
+	int64_t worst = 0;
+	for (int64_t s : samples) {
+		worst = s > worst ? s : worst;
+	}
+	const double ps[] = {50, 99, 99.9, 99.99};
+	const char* labels[] = {"p50", "p99", "p99.9", "p99.99"};
+	char label[64];
+	for (int k = 0; k < 4; k++) {
+		std::snprintf(label, sizeof(label), "%s push latency %s", name,
+			      labels[k]);
+		Bench::report(label, double(Bench::percentile(samples, ps[k])),
+			      "ns");
+	}
+	std::snprintf(label, sizeof(label), "%s push latency max", name);
+	Bench::report(label, double(worst), "ns");
+}
+
+template <typename Stack>
+void bench_throughput(const char* name, int n)
+{
+	int64_t t0 = Bench::now_ns();
+	{
+		Stack stack;
+		for (int i = 0; i < n; i++) {
+			stack.push(i);
+		}
+		long sum = 0;
+		while (stack.size() > 0) {
+			sum += stack.pop();
+		}
+		Bench::do_not_optimize(sum);
+	}
+	int64_t t1 = Bench::now_ns();
+	char label[64];
+	std::snprintf(label, sizeof(label), "%s push+pop", name);
+	Bench::report(label, double(t1 - t0) / n, "ns/elem");
+}
+
+int main()
+{
+	const int n = 1 << 22;
+	bench_latency<DataStructures::SegmentedStack<int>>("SegmentedStack", n);
+	bench_latency<DataStructures::StackWithArray<int>>("StackWithArray", n);
+	bench_throughput<DataStructures::SegmentedStack<int>>("SegmentedStack",
+							      n);
+	bench_throughput<DataStructures::StackWithArray<int>>("StackWithArray",
+							      n);
+	return 0;
+}
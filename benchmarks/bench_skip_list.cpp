@@ -0,0 +1,107 @@
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/doubly_linked_list.h"
+#include "data_structures/dynamic_array.h"
+#include "data_structures/skip_list.h"
+
+/*
+ * Every container holds the even numbers below 2n in order. Positional
+ * reads, inserts and erases then go to random indices; an insert adds a
+ * copy of the element at its index, which keeps the skip list sorted.
+ * The skip list additionally inserts and removes by key.
+ */
+void report(const char* label, const char* what, int n, double ns)
+{
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s %s n=%d", label, what, n);
+	Bench::report(name, ns, "ns/op");
+}
+
+template <typename List>
+void fill(List& list, int n)
+{
+	for (int i = 0; i < n; i++) {
+		list.add_last(2 * i);
+	}
+}
+
+void fill(DataStructures::SkipList<int>& list, int n)
+{
+	for (int i = 0; i < n; i++) {
+		list.add(2 * i);
+	}
+}
+
+template <typename List>
+void bench_positional(const char* label, int n, const std::vector<int>& idx)
+{
+	List list;
+	fill(list, n);
+	double ops = double(idx.size());
+	long sum = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int i : idx) {
+		sum += list.get(i);
+	}
+	int64_t t1 = Bench::now_ns();
+	Bench::do_not_optimize(sum);
+	report(label, "get(i)", n, double(t1 - t0) / ops);
+
+	t0 = Bench::now_ns();
+	for (int i : idx) {
+		list.add(i, list.get(i));
+	}
+	t1 = Bench::now_ns();
+	report(label, "add(i)", n, double(t1 - t0) / ops);
+
+	t0 = Bench::now_ns();
+	for (int i : idx) {
+		sum += list.del(i);
+	}
+	t1 = Bench::now_ns();
+	Bench::do_not_optimize(sum);
+	report(label, "del(i)", n, double(t1 - t0) / ops);
+}
+
+void bench_keyed(int n, const std::vector<int>& idx)
+{
+	DataStructures::SkipList<int> list;
+	fill(list, n);
+	double ops = double(idx.size());
+	int64_t t0 = Bench::now_ns();
+	for (int i : idx) {
+		list.add(2 * i + 1);
+	}
+	int64_t t1 = Bench::now_ns();
+	report("SkipList", "add(key)", n, double(t1 - t0) / ops);
+
+	size_t removed = 0;
+	t0 = Bench::now_ns();
+	for (int i : idx) {
+		removed += list.remove(2 * i + 1);
+	}
+	t1 = Bench::now_ns();
+	Bench::do_not_optimize(removed);
+	report("SkipList", "remove(key)", n, double(t1 - t0) / ops);
+}
+
+int main()
+{
+	for (int n : {1000, 100000}) {
+		std::vector<int> idx;
+		std::srand(1);
+		for (int i = 0; i < 2000; i++) {
+			idx.push_back(std::rand() % n);
+		}
+		bench_positional<DataStructures::SkipList<int>>("SkipList", n,
+								  idx);
+		bench_positional<DataStructures::DoublyLinkedList<int>>(
+			"DoublyLinkedList", n, idx);
+		bench_positional<DataStructures::DynamicArray<int>>(
+			"DynamicArray", n, idx);
+		bench_keyed(n, idx);
+	}
+	return 0;
+}
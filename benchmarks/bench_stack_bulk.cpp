@@ -0,0 +1,69 @@
+#include <cstdio>
+#include <iterator>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/stack.h"
+#include "data_structures/stack_with_array.h"
+#include "data_structures/stack_with_linked_list.h"
+
+/*
+ * Pushes and pops frames of a fixed number of elements, as a parser or
+ * evaluator does, once element by element and once with push_n/pop_n.
+ */
+template <typename Stack>
+void bench(const char* name, int frame, int rounds)
+{
+	std::vector<int> in(static_cast<size_t>(frame), 7);
+	std::vector<int> out(static_cast<size_t>(frame));
+	char label[64];
+	long sum = 0;
+
+	Stack single;
+	int64_t t0 = Bench::now_ns();
+	for (int r = 0; r < rounds; r++) {
+		for (int v : in) {
+			single.push(v);
+		}
+		for (int i = 0; i < frame; i++) {
+			sum += single.pop();
+		}
+	}
+	int64_t t1 = Bench::now_ns();
+	Bench::do_not_optimize(sum);
+	std::snprintf(label, sizeof(label), "%s push/pop frame=%d", name,
+		      frame);
+	Bench::report(label, double(t1 - t0) / rounds / frame, "ns/elem");
+
+	Stack bulk;
+	t0 = Bench::now_ns();
+	for (int r = 0; r < rounds; r++) {
+		bulk.push_n(in.begin(), in.end());
+		bulk.pop_n(out.begin(), size_t(frame));
+		sum += out[0];
+	}
+	t1 = Bench::now_ns();
+	Bench::do_not_optimize(sum);
+	std::snprintf(label, sizeof(label), "%s push_n/pop_n frame=%d", name,
+		      frame);
+	Bench::report(label, double(t1 - t0) / rounds / frame, "ns/elem");
+}
+
+int main()
+{
+	for (int frame : {8, 64, 512}) {
+		int rounds = 2000000 / frame;
+		bench<DataStructures::StackWithArray<int>>("StackWithArray",
+							   frame, rounds);
+		bench<DataStructures::StackWithLinkedList<int>>(
+			"StackWithLinkedList", frame, rounds);
+		bench<DataStructures::Stack<int>>("Stack<DynamicArray>", frame,
+						  rounds);
+		bench<DataStructures::Stack<
+			int, DataStructures::DoublyLinkedList<int>>>(
+			"Stack<DoublyLinkedList>", frame, rounds);
+		bench<DataStructures::Stack<
+			int, DataStructures::SinglyLinkedList<int>>>(
+			"Stack<SinglyLinkedList>", frame, rounds);
+	}
+	return 0;
+}
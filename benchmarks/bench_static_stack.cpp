@@ -0,0 +1,54 @@
+#include <cstdio>
+#include "bench_common.h"
+#include "data_structures/stack_with_array.h"
+#include "data_structures/stack_with_array_stl.h"
+#include "data_structures/stack_with_linked_list.h"
+#include "data_structures/stack_with_linked_list_stl.h"
+#include "data_structures/static_stack.h"
+
+/*
+ * Mimics the explicit stack of an iterative tree walk: every walk creates
+ * a fresh stack, pushes up to the depth of the tree and pops back down,
+ * so allocations made by the stack are part of the measured cost.
+ */
+template <typename Stack>
+void bench(const char* name, int depth, int walks)
+{
+	long sum = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int w = 0; w < walks; w++) {
+		Stack stack;
+		for (int i = 0; i < depth; i++) {
+			stack.push(i + w);
+		}
+		while (stack.size() > 0) {
+			sum += stack.pop();
+		}
+		Bench::do_not_optimize(sum);
+	}
+	int64_t t1 = Bench::now_ns();
+	char label[64];
+	std::snprintf(label, sizeof(label), "%s depth=%d", name, depth);
+	Bench::report(label, double(t1 - t0) / walks, "ns/walk");
+}
+
+int main()
+{
+	using namespace DataStructures;
+	const int walks = 200000;
+	for (int depth : {16, 48}) {
+		bench<StaticStack<int, 64>>("StaticStack<64>", depth, walks);
+		bench<StaticStack<int, 64, true>>("StaticStack<64, spill>",
+						  depth, walks);
+		bench<StackWithArray<int>>("StackWithArray", depth, walks);
+		bench<StackWithArraySTL<int>>("StackWithArraySTL", depth,
+					      walks);
+		bench<StackWithLinkedList<int>>("StackWithLinkedList", depth,
+						walks);
+		bench<StackWithLinkedListSTL<int>>("StackWithLinkedListSTL",
+						   depth, walks);
+	}
+	bench<StaticStack<int, 64, true>>("StaticStack<64, spill>", 100, walks);
+	bench<StackWithArray<int>>("StackWithArray", 100, walks);
+	return 0;
+}
@@ -0,0 +1,101 @@
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/doubly_linked_list.h"
+#include "data_structures/dynamic_array.h"
+#include "data_structures/unrolled_linked_list.h"
+
+/*
+ * Sequential traversal sums every element through the iterators, and
+ * positional access reads elements at random indices with get(). The
+ * doubly linked list has no iterators, so it only takes part in the
+ * positional test.
+ */
+template <typename List>
+void fill(List& list, int n)
+{
+	for (int i = 0; i < n; i++) {
+		list.add_last(i);
+	}
+}
+
+void report(const char* label, const char* what, int n, double ns)
+{
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s %s n=%d", label, what, n);
+	Bench::report(name, ns, "ns/elem");
+}
+
+template <typename List>
+void bench_traversal(const char* label, int n, int rounds)
+{
+	List list;
+	fill(list, n);
+	long sum = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int r = 0; r < rounds; r++) {
+		for (int v : list) {
+			sum += v;
+		}
+		Bench::do_not_optimize(sum);
+	}
+	int64_t t1 = Bench::now_ns();
+	report(label, "traversal", n, double(t1 - t0) / rounds / n);
+}
+
+void bench_array_traversal(int n, int rounds)
+{
+	DataStructures::DynamicArray<int> array;
+	fill(array, n);
+	long sum = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < array.get_size(); i++) {
+			sum += array[i];
+		}
+		Bench::do_not_optimize(sum);
+	}
+	int64_t t1 = Bench::now_ns();
+	report("DynamicArray", "traversal", n, double(t1 - t0) / rounds / n);
+}
+
+template <typename List>
+void bench_positional(const char* label, int n, const std::vector<int>& idx)
+{
+	List list;
+	fill(list, n);
+	long sum = 0;
+	int64_t t0 = Bench::now_ns();
+	for (int i : idx) {
+		sum += list.get(i);
+	}
+	int64_t t1 = Bench::now_ns();
+	Bench::do_not_optimize(sum);
+	report(label, "get(i)", n, double(t1 - t0) / double(idx.size()));
+}
+
+int main()
+{
+	for (int n : {1000, 100000}) {
+		int rounds = 20000000 / n;
+		bench_traversal<DataStructures::UnrolledLinkedList<int, 16>>(
+			"unrolled B=16", n, rounds);
+		bench_traversal<DataStructures::UnrolledLinkedList<int, 64>>(
+			"unrolled B=64", n, rounds);
+		bench_array_traversal(n, rounds);
+
+		std::vector<int> idx;
+		std::srand(1);
+		for (int i = 0; i < 2000; i++) {
+			idx.push_back(std::rand() % n);
+		}
+		bench_positional<DataStructures::UnrolledLinkedList<int, 16>>(
+			"unrolled B=16", n, idx);
+		bench_positional<DataStructures::UnrolledLinkedList<int, 64>>(
+			"unrolled B=64", n, idx);
+		bench_positional<DataStructures::DoublyLinkedList<int>>(
+			"DoublyLinkedList", n, idx);
+	}
+	return 0;
+}
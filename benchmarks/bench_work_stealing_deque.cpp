@@ -0,0 +1,103 @@
+#include <atomic>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "bench_common.h"
+#include "data_structures/deque_with_array.h"
+#include "data_structures/work_stealing_deque.h"
+
+/*
+ * Both deques are driven the same way: the owner pushes a batch of tasks
+ * and then works through it from the bottom while the thieves steal from
+ * the top. Reported is the total number of tasks taken per second and the
+ * share of them taken by thieves.
+ */
+struct LockedDeque {
+	std::mutex mtx;
+	DataStructures::DequeWithArray<int> dq;
+
+	void push(int v)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		dq.add_last(v);
+	}
+
+	bool pop(int& out)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		if (dq.size() == 0) {
+			return false;
+		}
+		out = dq.del_last();
+		return true;
+	}
+
+	bool steal(int& out)
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		if (dq.size() == 0) {
+			return false;
+		}
+		out = dq.del_first();
+		return true;
+	}
+};
+
+template <typename Deque>
+void bench(const char* label, int thieves, int rounds, int batch)
+{
+	Deque dq;
+	std::atomic<bool> done(false);
+	std::atomic<long> stolen(0);
+	std::vector<std::thread> threads;
+	for (int i = 0; i < thieves; i++) {
+		threads.emplace_back([&] {
+			long mine = 0;
+			int v;
+			while (!done.load(std::memory_order_relaxed)) {
+				if (dq.steal(v)) {
+					mine++;
+				}
+			}
+			stolen.fetch_add(mine);
+		});
+	}
+	int64_t t0 = Bench::now_ns();
+	long popped = 0;
+	for (int r = 0; r < rounds; r++) {
+		for (int i = 0; i < batch; i++) {
+			dq.push(i);
+		}
+		int v;
+		while (dq.pop(v)) {
+			popped++;
+		}
+	}
+	int64_t t1 = Bench::now_ns();
+	done.store(true);
+	for (std::thread& t : threads) {
+		t.join();
+	}
+	double total = double(popped + stolen.load());
+	char name[64];
+	std::snprintf(name, sizeof(name), "%s %d thieves", label, thieves);
+	Bench::report(name, total / (double(t1 - t0) / 1e9) / 1e6,
+		      "Mtasks/s");
+	std::snprintf(name, sizeof(name), "%s %d thieves stolen share", label,
+		      thieves);
+	Bench::report(name, 100.0 * double(stolen.load()) / total, "%");
+}
+
+int main()
+{
+	unsigned hw = std::thread::hardware_concurrency();
+	int max_thieves = hw > 1 ? int(hw) - 1 : 1;
+	for (int thieves = 1; thieves <= max_thieves; thieves *= 2) {
+		bench<DataStructures::WorkStealingDeque<int>>(
+			"chase-lev", thieves, 2000, 1000);
+		bench<LockedDeque>("mutex DequeWithArray", thieves, 2000,
+				   1000);
+	}
+	return 0;
+}
@@ -0,0 +1,13 @@
+# Helper function: convert snake_case to PascalCase
+function(to_pascal_case out_var input)
+        string(REPLACE "_" ";" words ${input})
+        set(result "")
+        foreach(word IN LISTS words)
+                string(SUBSTRING ${word} 0 1 first)
+                string(SUBSTRING ${word} 1 -1 rest)
+                string(TOUPPER ${first} first)
+                string(TOLOWER ${rest} rest)
+                set(result "${result}${first}${rest}")
+        endforeach()
+        set(${out_var} "${result}" PARENT_SCOPE)
+endfunction()
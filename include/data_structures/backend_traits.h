@@ -0,0 +1,420 @@
+#ifndef DATA_STRUCTURES_BACKEND_TRAITS_H
+#define DATA_STRUCTURES_BACKEND_TRAITS_H
+
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <utility>
+#include <vector>
+
+#include "circular_array.h"
+#include "compact_linked_list.h"
+#include "doubly_linked_list.h"
+#include "dynamic_array.h"
+#include "singly_linked_list.h"
+#include "unrolled_linked_list.h"
+
+namespace DataStructures {
+
+/**
+ * @brief Describes how the @ref Stack, @ref Queue and @ref Deque adapters
+ *        use a container as their backend.
+ *
+ * A specialization provides the element type, static functions adding,
+ * removing and reading elements at both ends, bulk functions adding a
+ * range and deleting or copying several elements at either end, and four
+ * flags telling which of the end operations take O(1) time. The adapters
+ * only accept backends whose flags cover the operations they need, so
+ * picking an unsuitable backend fails to compile instead of silently
+ * taking O(n) time. Removing and copying functions may assume that the
+ * container holds enough elements, the adapters check that first.
+ *
+ * The bulk functions default to looping over the single ones, and
+ * specializations forward them to the bulk operations of containers that
+ * have them.
+ *
+ * Specializations exist for every sequence container of the library and
+ * for @c std::vector, @c std::deque and @c std::list; further backends can
+ * be added by specializing this template.
+ *
+ * @tparam Container The backend container type.
+ */
+template <typename Container>
+struct BackendTraits {
+	static_assert(sizeof(Container) == 0,
+		      "No BackendTraits specialization for this container");
+};
+
+/**
+ * @brief End operations of the containers of this library, which share
+ *        their names.
+ * @tparam Container The container type.
+ * @tparam T Type of the elements.
+ */
+template <typename Container, typename T>
+struct LibraryBackendTraits {
+	typedef T value_type;
+
+	static void add_first(Container& c, const T& x) { c.add_first(x); }
+	static void add_last(Container& c, const T& x) { c.add_last(x); }
+	static T del_first(Container& c) { return c.del_first(); }
+	static T del_last(Container& c) { return c.del_last(); }
+	static T get_first(const Container& c) { return c.get_first(); }
+	static T get_last(const Container& c) { return c.get_last(); }
+	static size_t size(const Container& c) { return c.get_size(); }
+	static bool empty(const Container& c) { return c.is_empty(); }
+
+	/** @brief Adds the elements of a range at the end, in order. */
+	template <typename InputIt>
+	static void append(Container& c, InputIt first, InputIt last)
+	{
+		for (; first != last; ++first) {
+			c.add_last(*first);
+		}
+	}
+
+	/**
+         * @brief Adds the elements of a range at the front in turn, so the
+         *        last one ends up first.
+         */
+	template <typename InputIt>
+	static void prepend_reversed(Container& c, InputIt first, InputIt last)
+	{
+		for (; first != last; ++first) {
+			c.add_first(*first);
+		}
+	}
+
+	/** @brief Deletes the first @p n elements, writing the first first. */
+	template <typename OutputIt>
+	static OutputIt del_first_n(Container& c, size_t n, OutputIt out)
+	{
+		for (size_t i = 0; i < n; i++) {
+			*out++ = c.del_first();
+		}
+		return out;
+	}
+
+	/** @brief Deletes the last @p n elements, writing the last first. */
+	template <typename OutputIt>
+	static OutputIt del_last_n(Container& c, size_t n, OutputIt out)
+	{
+		for (size_t i = 0; i < n; i++) {
+			*out++ = c.del_last();
+		}
+		return out;
+	}
+
+	/** @brief Copies the first @p n elements, the first one first. */
+	template <typename OutputIt>
+	static OutputIt copy_first(const Container& c, size_t n, OutputIt out)
+	{
+		auto it = c.begin();
+		for (size_t i = 0; i < n; i++, ++it) {
+			*out++ = *it;
+		}
+		return out;
+	}
+
+	/** @brief Copies the last @p n elements, the last one first. */
+	template <typename OutputIt>
+	static OutputIt copy_last(const Container& c, size_t n, OutputIt out)
+	{
+		auto it = c.end();
+		for (size_t i = 0; i < n; i++) {
+			*out++ = *--it;
+		}
+		return out;
+	}
+};
+
+/**
+ * @brief End operations of the standard sequence containers, moving the
+ *        removed element out before popping it.
+ * @tparam Container The container type.
+ */
+template <typename Container>
+struct StdBackendTraits {
+	typedef typename Container::value_type value_type;
+	typedef value_type T;
+
+	static void add_first(Container& c, const T& x) { c.push_front(x); }
+	static void add_last(Container& c, const T& x) { c.push_back(x); }
+
+	static T del_first(Container& c)
+	{
+		T x = std::move(c.front());
+		c.pop_front();
+		return x;
+	}
+
+	static T del_last(Container& c)
+	{
+		T x = std::move(c.back());
+		c.pop_back();
+		return x;
+	}
+
+	static T get_first(const Container& c) { return c.front(); }
+	static T get_last(const Container& c) { return c.back(); }
+	static size_t size(const Container& c) { return c.size(); }
+	static bool empty(const Container& c) { return c.empty(); }
+
+	template <typename InputIt>
+	static void append(Container& c, InputIt first, InputIt last)
+	{
+		c.insert(c.end(), first, last);
+	}
+
+	template <typename InputIt>
+	static void prepend_reversed(Container& c, InputIt first, InputIt last)
+	{
+		for (; first != last; ++first) {
+			c.push_front(*first);
+		}
+	}
+
+	template <typename OutputIt>
+	static OutputIt del_first_n(Container& c, size_t n, OutputIt out)
+	{
+		auto it = c.begin();
+		for (size_t i = 0; i < n; i++, ++it) {
+			*out++ = std::move(*it);
+		}
+		c.erase(c.begin(), it);
+		return out;
+	}
+
+	template <typename OutputIt>
+	static OutputIt del_last_n(Container& c, size_t n, OutputIt out)
+	{
+		auto it = c.end();
+		for (size_t i = 0; i < n; i++) {
+			*out++ = std::move(*--it);
+		}
+		c.erase(it, c.end());
+		return out;
+	}
+
+	template <typename OutputIt>
+	static OutputIt copy_first(const Container& c, size_t n, OutputIt out)
+	{
+		auto it = c.begin();
+		for (size_t i = 0; i < n; i++, ++it) {
+			*out++ = *it;
+		}
+		return out;
+	}
+
+	template <typename OutputIt>
+	static OutputIt copy_last(const Container& c, size_t n, OutputIt out)
+	{
+		auto it = c.rbegin();
+		for (size_t i = 0; i < n; i++, ++it) {
+			*out++ = *it;
+		}
+		return out;
+	}
+};
+
+/** @brief DynamicArray, fast at its end only. */
+template <typename T>
+struct BackendTraits<DynamicArray<T>>
+	: LibraryBackendTraits<DynamicArray<T>, T> {
+	static const bool fast_add_first = false;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = false;
+	static const bool fast_del_last = true;
+
+	static T get_first(const DynamicArray<T>& c) { return c[0]; }
+
+	static T get_last(const DynamicArray<T>& c)
+	{
+		return c[c.get_size() - 1];
+	}
+
+	/** @brief Copies the range in with a single reservation. */
+	template <typename ForwardIt>
+	static void append(DynamicArray<T>& c, ForwardIt first, ForwardIt last)
+	{
+		c.append(first, last);
+	}
+
+	/** @brief Moves the elements out, then shrinks at most once. */
+	template <typename OutputIt>
+	static OutputIt del_last_n(DynamicArray<T>& c, size_t n, OutputIt out)
+	{
+		size_t size = c.get_size();
+		for (size_t i = size; i > size - n; i--) {
+			*out++ = std::move(c[i - 1]);
+		}
+		c.del_last_n(n);
+		return out;
+	}
+
+	template <typename OutputIt>
+	static OutputIt copy_first(const DynamicArray<T>& c, size_t n,
+				   OutputIt out)
+	{
+		for (size_t i = 0; i < n; i++) {
+			*out++ = c[i];
+		}
+		return out;
+	}
+
+	template <typename OutputIt>
+	static OutputIt copy_last(const DynamicArray<T>& c, size_t n,
+				  OutputIt out)
+	{
+		for (size_t i = c.get_size(); i > c.get_size() - n; i--) {
+			*out++ = c[i - 1];
+		}
+		return out;
+	}
+};
+
+/** @brief CircularArray, fast at both ends. */
+template <typename T>
+struct BackendTraits<CircularArray<T>>
+	: LibraryBackendTraits<CircularArray<T>, T> {
+	static const bool fast_add_first = true;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = true;
+	static const bool fast_del_last = true;
+};
+
+/** @brief SinglyLinkedList, which cannot delete its last node in O(1). */
+template <typename T>
+struct BackendTraits<SinglyLinkedList<T>>
+	: LibraryBackendTraits<SinglyLinkedList<T>, T> {
+	static const bool fast_add_first = true;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = true;
+	static const bool fast_del_last = false;
+
+	/** @brief Links the range in front as one chain. */
+	template <typename InputIt>
+	static void prepend_reversed(SinglyLinkedList<T>& c, InputIt first,
+				     InputIt last)
+	{
+		c.prepend_reversed(first, last);
+	}
+};
+
+/** @brief DoublyLinkedList, fast at both ends. */
+template <typename T>
+struct BackendTraits<DoublyLinkedList<T>>
+	: LibraryBackendTraits<DoublyLinkedList<T>, T> {
+	static const bool fast_add_first = true;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = true;
+	static const bool fast_del_last = true;
+
+	/** @brief Links the range onto the end as one chain. */
+	template <typename InputIt>
+	static void append(DoublyLinkedList<T>& c, InputIt first, InputIt last)
+	{
+		c.append(first, last);
+	}
+
+	/** @brief Moves the elements out, then relinks the end once. */
+	template <typename OutputIt>
+	static OutputIt del_last_n(DoublyLinkedList<T>& c, size_t n,
+				   OutputIt out)
+	{
+		auto it = c.end();
+		for (size_t i = 0; i < n; i++) {
+			*out++ = std::move(*--it);
+		}
+		c.del_last_n(n);
+		return out;
+	}
+};
+
+/** @brief CompactLinkedList, fast at both ends. */
+template <typename T>
+struct BackendTraits<CompactLinkedList<T>>
+	: LibraryBackendTraits<CompactLinkedList<T>, T> {
+	static const bool fast_add_first = true;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = true;
+	static const bool fast_del_last = true;
+};
+
+/** @brief UnrolledLinkedList, fast at both ends. */
+template <typename T, size_t B>
+struct BackendTraits<UnrolledLinkedList<T, B>>
+	: LibraryBackendTraits<UnrolledLinkedList<T, B>, T> {
+	static const bool fast_add_first = true;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = true;
+	static const bool fast_del_last = true;
+
+	/**
+         * @brief Copies the last @p n elements, the last one first. The
+         *        list only iterates forwards, so this takes O(size) time.
+         */
+	template <typename OutputIt>
+	static OutputIt copy_last(const UnrolledLinkedList<T, B>& c, size_t n,
+				  OutputIt out)
+	{
+		std::vector<T> tail;
+		tail.reserve(n);
+		auto it = c.begin();
+		std::advance(it, c.get_size() - n);
+		for (; it != c.end(); ++it) {
+			tail.push_back(*it);
+		}
+		for (size_t i = n; i > 0; i--) {
+			*out++ = tail[i - 1];
+		}
+		return out;
+	}
+};
+
+/** @brief std::vector, fast at its end only. */
+template <typename T, typename Alloc>
+struct BackendTraits<std::vector<T, Alloc>>
+	: StdBackendTraits<std::vector<T, Alloc>> {
+	static const bool fast_add_first = false;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = false;
+	static const bool fast_del_last = true;
+
+	static void add_first(std::vector<T, Alloc>& c, const T& x)
+	{
+		c.insert(c.begin(), x);
+	}
+
+	static T del_first(std::vector<T, Alloc>& c)
+	{
+		T x = std::move(c.front());
+		c.erase(c.begin());
+		return x;
+	}
+};
+
+/** @brief std::deque, fast at both ends. */
+template <typename T, typename Alloc>
+struct BackendTraits<std::deque<T, Alloc>>
+	: StdBackendTraits<std::deque<T, Alloc>> {
+	static const bool fast_add_first = true;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = true;
+	static const bool fast_del_last = true;
+};
+
+/** @brief std::list, fast at both ends. */
+template <typename T, typename Alloc>
+struct BackendTraits<std::list<T, Alloc>>
+	: StdBackendTraits<std::list<T, Alloc>> {
+	static const bool fast_add_first = true;
+	static const bool fast_add_last = true;
+	static const bool fast_del_first = true;
+	static const bool fast_del_last = true;
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_BACKEND_TRAITS_H
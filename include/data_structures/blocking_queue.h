@@ -0,0 +1,253 @@
+#ifndef DATA_STRUCTURES_BLOCKING_QUEUE_H
+#define DATA_STRUCTURES_BLOCKING_QUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+
+#include "queue_with_array.h"
+
+namespace DataStructures {
+
+/**
+ * @class BlockingQueue
+ * @brief Thread-safe bounded FIFO queue with blocking and timed operations.
+ *
+ * A @ref QueueWithArray guarded by a mutex. Producers block while the queue
+ * is full and consumers block while it is empty, each on their own
+ * condition variable. The number of sleeping producers and consumers is
+ * tracked so that an operation only signals when somebody is actually
+ * waiting, and then wakes exactly one waiter, which avoids both futile
+ * notify syscalls and thundering herds. Only @ref close() wakes everyone.
+ *
+ * Once closed, pushes fail immediately while pops keep draining the
+ * remaining elements and fail only when the queue is empty.
+ *
+ * @tparam T Type of the implementation class.
+ */
+template <typename T>
+class BlockingQueue {
+public:
+	/**
+         * @brief Constructor for the BlockingQueue class.
+         * @param capacity Maximum number of elements held at once.
+         * @throws std::invalid_argument if @p capacity is zero.
+         */
+	explicit BlockingQueue(size_t capacity)
+		: cap(capacity)
+		, closed(false)
+		, waiting_producers(0)
+		, waiting_consumers(0)
+	{
+		if (capacity == 0) {
+			throw std::invalid_argument("Capacity must be positive");
+		}
+	}
+
+	BlockingQueue(const BlockingQueue&) = delete;
+	BlockingQueue& operator=(const BlockingQueue&) = delete;
+
+	/**
+         * @brief Pushes an element at the back of the queue, waiting for
+         *        space if the queue is full.
+         * @param element The element to be pushed.
+         * @return true if the element was pushed, false if the queue is
+         *         closed.
+         */
+	bool push(const T& element)
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+		while (queue.size() == cap && !closed) {
+			wait(not_full, waiting_producers, lock);
+		}
+		return push_locked(element, lock);
+	}
+
+	/**
+         * @brief Pushes an element at the back of the queue, waiting at most
+         *        @p timeout for space if the queue is full.
+         * @param element The element to be pushed.
+         * @param timeout Maximum time to wait.
+         * @return true if the element was pushed, false on timeout or if the
+         *         queue is closed.
+         */
+	template <typename Rep, typename Period>
+	bool try_push_for(const T& element,
+			  const std::chrono::duration<Rep, Period>& timeout)
+	{
+		std::chrono::steady_clock::time_point deadline =
+			std::chrono::steady_clock::now() + timeout;
+		std::unique_lock<std::mutex> lock(mtx);
+		while (queue.size() == cap && !closed) {
+			if (!wait_until(not_full, waiting_producers, lock,
+					deadline)) {
+				break;
+			}
+		}
+		if (queue.size() == cap) {
+			return false;
+		}
+		return push_locked(element, lock);
+	}
+
+	/**
+         * @brief Pops the element at the front of the queue, waiting for one
+         *        if the queue is empty.
+         * @param out Receives the popped element.
+         * @return true if an element was popped, false if the queue is closed
+         *         and empty.
+         */
+	bool pop(T& out)
+	{
+		std::unique_lock<std::mutex> lock(mtx);
+		while (queue.size() == 0 && !closed) {
+			wait(not_empty, waiting_consumers, lock);
+		}
+		return pop_locked(out, lock);
+	}
+
+	/**
+         * @brief Pops the element at the front of the queue, waiting at most
+         *        @p timeout for one if the queue is empty.
+         * @param out Receives the popped element.
+         * @param timeout Maximum time to wait.
+         * @return true if an element was popped, false on timeout or if the
+         *         queue is closed and empty.
+         */
+	template <typename Rep, typename Period>
+	bool try_pop_for(T& out,
+			 const std::chrono::duration<Rep, Period>& timeout)
+	{
+		std::chrono::steady_clock::time_point deadline =
+			std::chrono::steady_clock::now() + timeout;
+		std::unique_lock<std::mutex> lock(mtx);
+		while (queue.size() == 0 && !closed) {
+			if (!wait_until(not_empty, waiting_consumers, lock,
+					deadline)) {
+				break;
+			}
+		}
+		return pop_locked(out, lock);
+	}
+
+	/**
+         * @brief Closes the queue and wakes every waiting thread.
+         *
+         * Subsequent pushes fail, pops fail once the remaining elements have
+         * been drained. Closing more than once has no further effect.
+         */
+	void close()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			closed = true;
+		}
+		not_full.notify_all();
+		not_empty.notify_all();
+	}
+
+	/**
+         * @brief Check if the queue has been closed.
+         * @return true if @ref close() has been called, false otherwise.
+         */
+	bool is_closed() const
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		return closed;
+	}
+
+	/**
+         * @brief Gets the current size of the queue.
+         * @return The number of elements at the time of the call.
+         */
+	size_t size() const
+	{
+		std::lock_guard<std::mutex> lock(mtx);
+		return queue.size();
+	}
+
+	/**
+         * @brief Gets the maximum number of elements held at once.
+         * @return The capacity of the queue.
+         */
+	size_t capacity() const { return cap; }
+
+private:
+	/** Guards every member below except the immutable capacity. */
+	mutable std::mutex mtx;
+	/** Signalled when an element is popped. */
+	std::condition_variable not_full;
+	/** Signalled when an element is pushed. */
+	std::condition_variable not_empty;
+	/** The queue holding the elements. */
+	QueueWithArray<T> queue;
+	/** Maximum number of elements. */
+	const size_t cap;
+	/** Whether @ref close() has been called. */
+	bool closed;
+	/** Number of producers sleeping on @ref not_full. */
+	size_t waiting_producers;
+	/** Number of consumers sleeping on @ref not_empty. */
+	size_t waiting_consumers;
+
+	static void wait(std::condition_variable& cv, size_t& waiters,
+			 std::unique_lock<std::mutex>& lock)
+	{
+		waiters++;
+		cv.wait(lock);
+		waiters--;
+	}
+
+	/** @return false if the deadline passed, true otherwise. */
+	static bool wait_until(std::condition_variable& cv, size_t& waiters,
+			       std::unique_lock<std::mutex>& lock,
+			       std::chrono::steady_clock::time_point deadline)
+	{
+		waiters++;
+		std::cv_status status = cv.wait_until(lock, deadline);
+		waiters--;
+		return status == std::cv_status::no_timeout;
+	}
+
+	/**
+         * @brief Pushes with the lock held, then releases the lock before
+         *        waking a consumer so the woken thread does not immediately
+         *        block on the mutex.
+         */
+	bool push_locked(const T& element, std::unique_lock<std::mutex>& lock)
+	{
+		if (closed) {
+			return false;
+		}
+		queue.push(element);
+		bool wake = waiting_consumers > 0;
+		lock.unlock();
+		if (wake) {
+			not_empty.notify_one();
+		}
+		return true;
+	}
+
+	/**
+         * @brief Pops with the lock held, then releases the lock before
+         *        waking a producer.
+         */
+	bool pop_locked(T& out, std::unique_lock<std::mutex>& lock)
+	{
+		if (queue.size() == 0) {
+			return false;
+		}
+		out = queue.pop();
+		bool wake = waiting_producers > 0;
+		lock.unlock();
+		if (wake) {
+			not_full.notify_one();
+		}
+		return true;
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_BLOCKING_QUEUE_H
@@ -1,25 +1,60 @@
 #ifndef DATA_STRUCTURES_CIRCULAR_ARRAY_H
 #define DATA_STRUCTURES_CIRCULAR_ARRAY_H
 
+#include <cstddef>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+#include "span.h"
+
 namespace DataStructures {
 
 template <typename T>
 class CircularArray {
+	template <bool IsConst>
+	class Iterator;
+
 public:
-	CircularArray() : CircularArray(1) {}
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+
+	// Allocates nothing until the first element is added.
+	CircularArray() noexcept : start(0), finish(0), size(0) {}
 
 	explicit CircularArray(size_t init_size)
-		: arr(init_size), start(0), end(0), size(0)
+		: arr(init_size), start(0), finish(0), size(0)
+	{
+	}
+
+	CircularArray(const CircularArray&) = default;
+
+	CircularArray(CircularArray&& other) noexcept : CircularArray()
 	{
+		swap(other);
+	}
+
+	// Takes other by value, so both copy and move assignment end up here.
+	CircularArray& operator=(CircularArray other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	void swap(CircularArray& other) noexcept
+	{
+		arr.swap(other.arr);
+		std::swap(start, other.start);
+		std::swap(finish, other.finish);
+		std::swap(size, other.size);
 	}
 
 	void add_first(const T& val)
 	{
 		if (is_full()) {
-			resize(arr.size() * 2);
+			grow();
 		}
 		start = (start - 1 + int(arr.size())) % int(arr.size());
 		arr[static_cast<size_t>(start)] = val;
@@ -29,10 +64,10 @@ public:
 	void add_last(const T& val)
 	{
 		if (is_full()) {
-			resize(arr.size() * 2);
+			grow();
 		}
-		arr[static_cast<size_t>(end)] = val;
-		end = (end + 1) % int(arr.size());
+		arr[static_cast<size_t>(finish)] = val;
+		finish = (finish + 1) % int(arr.size());
 		size++;
 	}
 
@@ -56,9 +91,9 @@ public:
 		if (is_empty()) {
 			throw std::out_of_range("Array is empty");
 		}
-		end = (end - 1 + int(arr.size())) % int(arr.size());
-		T val = arr[static_cast<size_t>(end)];
-		arr[static_cast<size_t>(end)] = T();
+		finish = (finish - 1 + int(arr.size())) % int(arr.size());
+		T val = arr[static_cast<size_t>(finish)];
+		arr[static_cast<size_t>(finish)] = T();
 		size--;
 		if (size > 0 && int(size) == int(arr.size()) / 4) {
 			resize(arr.size() / 2);
@@ -66,6 +101,32 @@ public:
 		return val;
 	}
 
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the array was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the array was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_last();
+		return true;
+	}
+
 	T get_first() const
 	{
 		if (is_empty()) {
@@ -79,10 +140,56 @@ public:
 		if (is_empty()) {
 			throw std::out_of_range("Array is empty");
 		}
-		return arr[static_cast<size_t>((end - 1 + int(arr.size())) %
+		return arr[static_cast<size_t>((finish - 1 + int(arr.size())) %
 					       int(arr.size()))];
 	}
 
+	T get(int index) const
+	{
+		if (index < 0 || index >= int(size)) {
+			throw std::out_of_range("Index out of bounds");
+		}
+		return arr[physical(static_cast<size_t>(index))];
+	}
+
+	T& operator[](size_t index) { return arr[physical(index)]; }
+
+	const T& operator[](size_t index) const
+	{
+		return arr[physical(index)];
+	}
+
+	iterator begin() { return iterator(this, 0); }
+
+	iterator end() { return iterator(this, size); }
+
+	const_iterator begin() const { return const_iterator(this, 0); }
+
+	const_iterator end() const { return const_iterator(this, size); }
+
+	const_iterator cbegin() const { return begin(); }
+
+	const_iterator cend() const { return end(); }
+
+	// The elements in logical order as at most two contiguous runs: the
+	// first from start up to the physical end of the storage, the second
+	// (empty unless wrapped) from the beginning of the storage.
+	std::pair<Span<T>, Span<T>> segments()
+	{
+		size_t head = first_segment_size();
+		return std::make_pair(
+			Span<T>(arr.data() + start, head),
+			Span<T>(arr.data(), size - head));
+	}
+
+	std::pair<Span<const T>, Span<const T>> segments() const
+	{
+		size_t head = first_segment_size();
+		return std::make_pair(
+			Span<const T>(arr.data() + start, head),
+			Span<const T>(arr.data(), size - head));
+	}
+
 	bool is_full() const { return size == arr.size(); }
 
 	size_t get_size() const { return size; }
@@ -92,19 +199,175 @@ public:
 private:
 	std::vector<T> arr;
 	int start;
-	int end;
+	int finish;
 	size_t size;
 
+	size_t physical(size_t index) const
+	{
+		size_t i = static_cast<size_t>(start) + index;
+		return i < arr.size() ? i : i - arr.size();
+	}
+
+	size_t first_segment_size() const
+	{
+		size_t room = arr.size() - static_cast<size_t>(start);
+		return size < room ? size : room;
+	}
+
+	void grow() { resize(arr.empty() ? 1 : arr.size() * 2); }
+
 	void resize(size_t new_size)
 	{
+		if (size == 0) {
+			arr.assign(new_size, T());
+			start = finish = 0;
+			return;
+		}
 		std::vector<T> new_arr(new_size);
 		for (size_t i = 0; i < size; i++) {
-			new_arr[i] = arr[static_cast<size_t>((start + int(i)) %
-							     int(arr.size()))];
+			new_arr[i] = arr[physical(i)];
 		}
 		arr = std::move(new_arr);
 		start = 0;
-		end = int(size);
+		finish = int(size);
+	}
+};
+
+template <typename T>
+template <bool IsConst>
+class CircularArray<T>::Iterator {
+	typedef typename std::conditional<IsConst, const CircularArray<T>,
+					  CircularArray<T>>::type Owner;
+
+public:
+	typedef std::random_access_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+	typedef typename std::conditional<IsConst, const T&, T&>::type
+		reference;
+
+	Iterator() : owner(nullptr), index(0) {}
+
+	Iterator(Owner* ca, size_t pos) : owner(ca), index(pos) {}
+
+	// Allows an iterator to be passed where a const_iterator is expected.
+	template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+	Iterator(const Iterator<false>& other)
+		: owner(other.owner), index(other.index)
+	{
+	}
+
+	reference operator*() const { return (*owner)[index]; }
+
+	pointer operator->() const { return &(*owner)[index]; }
+
+	reference operator[](difference_type n) const
+	{
+		return (*owner)[offset(n)];
+	}
+
+	Iterator& operator++()
+	{
+		index++;
+		return *this;
+	}
+
+	Iterator operator++(int)
+	{
+		Iterator old = *this;
+		index++;
+		return old;
+	}
+
+	Iterator& operator--()
+	{
+		index--;
+		return *this;
+	}
+
+	Iterator operator--(int)
+	{
+		Iterator old = *this;
+		index--;
+		return old;
+	}
+
+	Iterator& operator+=(difference_type n)
+	{
+		index = offset(n);
+		return *this;
+	}
+
+	Iterator& operator-=(difference_type n)
+	{
+		index = offset(-n);
+		return *this;
+	}
+
+	Iterator operator+(difference_type n) const
+	{
+		return Iterator(owner, offset(n));
+	}
+
+	friend Iterator operator+(difference_type n, const Iterator& it)
+	{
+		return it + n;
+	}
+
+	Iterator operator-(difference_type n) const
+	{
+		return Iterator(owner, offset(-n));
+	}
+
+	difference_type operator-(const Iterator& other) const
+	{
+		return static_cast<difference_type>(index) -
+		       static_cast<difference_type>(other.index);
+	}
+
+	bool operator==(const Iterator& other) const
+	{
+		return index == other.index;
+	}
+
+	bool operator!=(const Iterator& other) const
+	{
+		return index != other.index;
+	}
+
+	bool operator<(const Iterator& other) const
+	{
+		return index < other.index;
+	}
+
+	bool operator>(const Iterator& other) const
+	{
+		return index > other.index;
+	}
+
+	bool operator<=(const Iterator& other) const
+	{
+		return index <= other.index;
+	}
+
+	bool operator>=(const Iterator& other) const
+	{
+		return index >= other.index;
+	}
+
+private:
+	friend class Iterator<!IsConst>;
+
+	Owner* owner;
+	// Logical index into the owner, i.e. the distance from its first
+	// element; wraparound is resolved by CircularArray::operator[].
+	size_t index;
+
+	size_t offset(difference_type n) const
+	{
+		return static_cast<size_t>(
+			static_cast<difference_type>(index) + n);
 	}
 };
 
@@ -0,0 +1,971 @@
+/** @brief Implementation of an index linked list in contiguous storage. */
+
+#ifndef DATA_STRUCTURES_COMPACT_LINKED_LIST_H
+#define DATA_STRUCTURES_COMPACT_LINKED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "dynamic_array.h"
+
+namespace DataStructures {
+
+/**
+ * @class CompactLinkedList
+ * @brief Doubly linked list keeping its nodes in one @ref DynamicArray and
+ *        linking them by 32-bit indices instead of pointers.
+ *
+ * A node is the element followed by two 32-bit links, so for small
+ * elements it is a third of the size of a @ref DoublyLinkedList node and
+ * carries no allocator overhead. Nodes of deleted elements are threaded
+ * onto a free list through their next links and reused first, so the node
+ * array only grows when every slot is taken. It is shrunk again by
+ * @ref clear().
+ *
+ * Since links are indices, they survive the node array being reallocated
+ * and copying the list is a plain copy of the array. Iterators and cursors
+ * also hold an index and stay valid until their element is deleted, while
+ * references to elements are invalidated when the array grows.
+ *
+ * Sorting and merging relink indices as in @ref DoublyLinkedList, but
+ * every list has its own array, so nodes cannot move between lists: the
+ * functions taking elements from another list copy them in O(n), and
+ * there is no splice. Nodes do not come from a pool either, so there is no
+ * get_pool(), compact() or freeze().
+ *
+ * @tparam T Type of the implementation class, default constructible.
+ */
+template <typename T>
+class CompactLinkedList {
+	template <bool IsConst>
+	class Iterator;
+
+public:
+	class Cursor;
+
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+
+	/**
+         * @brief Constructor for an empty CompactLinkedList.
+         *
+         * The node array is allocated along with the first node.
+         */
+	CompactLinkedList() noexcept
+		: head(npos), tail(npos), free_head(npos), size(0)
+	{
+	}
+
+	/**
+         * @brief Move constructor, taking over the nodes of another list in
+         *        O(1) and leaving it empty.
+         * @param other The list to move from.
+         */
+	CompactLinkedList(CompactLinkedList&& other) noexcept
+		: CompactLinkedList()
+	{
+		swap(other);
+	}
+
+	/**
+         * @brief Copy constructor, copying the node array as it is.
+         * @param other The list to copy.
+         */
+	CompactLinkedList(const CompactLinkedList& other) = default;
+
+	/**
+         * @brief Assignment, replacing the elements by those of another
+         *        list.
+         * @param other The list to take the elements from, copied or moved
+         *              as appropriate.
+         * @return Reference to this list.
+         */
+	CompactLinkedList& operator=(CompactLinkedList other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	/* Insert functions */
+	/**
+         * @brief Adds a new node at the start of the list.
+         * @param data The data of the node.
+         */
+	void add_first(const T& data)
+	{
+		uint32_t x = new_node(data);
+		link_between(npos, x, head);
+	}
+
+	/**
+         * @brief Adds a new node at the end of the list.
+         * @param data The data of the node.
+         */
+	void add_last(const T& data)
+	{
+		uint32_t x = new_node(data);
+		link_between(tail, x, npos);
+	}
+
+	/**
+         * @brief Adds a new node at a valid position index.
+         *
+         * The node at the position is found by walking from the nearer end,
+         * and the new node is linked in before it.
+         *
+         * @param pos_index Position index at which the new node is to be
+         *                  added.
+         * @param data Data of the node to be added.
+         */
+	void add(int pos_index, const T& data)
+	{
+		check_position_index(pos_index);
+		if (pos_index == int(size)) {
+			add_last(data);
+			return;
+		}
+		uint32_t p = get_node(pos_index);
+		uint32_t x = new_node(data);
+		link_between(nodes[p].prev, x, p);
+	}
+
+	/* Delete functions */
+	/**
+         * @brief Delete the first node in the list.
+         * @return The data of the first node that will be deleted.
+         */
+	T del_first()
+	{
+		if (size == 0) {
+			throw std::out_of_range("No elements to remove");
+		}
+		return unlink(head);
+	}
+
+	/**
+         * @brief Delete the last node in the list.
+         * @return The data of the ending node that will be deleted.
+         */
+	T del_last()
+	{
+		if (size == 0) {
+			throw std::out_of_range("No elements to remove");
+		}
+		return unlink(tail);
+	}
+
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_last();
+		return true;
+	}
+
+	/**
+         * @brief Delete a node at a particular index.
+         * @param index Index of the node to be deleted.
+         * @return The data of the node that will be deleted.
+         */
+	T del(int index) { return unlink(get_node(index)); }
+
+	/* Get Functions */
+	/**
+         * @brief Get the data stored in the first node.
+         * @return The data in the first node.
+         * @throws std::out_of_range when the list is empty.
+         */
+	T get_first() const
+	{
+		if (is_empty()) {
+			throw std::out_of_range("No nodes in the list");
+		}
+		return nodes[head].data;
+	}
+
+	/**
+         * @brief Get the data stored in the last node.
+         * @return The data in the last node.
+         * @throws std::out_of_range when the list is empty.
+         */
+	T get_last() const
+	{
+		if (is_empty()) {
+			throw std::out_of_range("No nodes in the list");
+		}
+		return nodes[tail].data;
+	}
+
+	/**
+         * @brief Get the data stored in a node at a particular index.
+         * @param index Index of the element.
+         * @return The data of the requested node.
+         */
+	T get(int index) const { return nodes[get_node(index)].data; }
+
+	/* Set function */
+	/**
+         * @brief Set the data in a node at a particular index.
+         * @param index Index of the node to be set.
+         * @param data Value to be set to.
+         * @return The old data.
+         */
+	T set(int index, T data)
+	{
+		T& slot = nodes[get_node(index)].data;
+		T old_val = slot;
+		slot = data;
+		return old_val;
+	}
+
+	/* Bulk erase functions */
+	/**
+         * @brief Deletes every element satisfying a predicate in one pass.
+         * @param pred Predicate called with every element.
+         * @return The number of deleted elements.
+         */
+	template <typename Predicate>
+	size_t erase_if(Predicate pred)
+	{
+		size_t removed = 0;
+		uint32_t p = head;
+		while (p != npos) {
+			uint32_t next = nodes[p].next;
+			if (pred(static_cast<const T&>(nodes[p].data))) {
+				unlink(p);
+				removed++;
+			}
+			p = next;
+		}
+		return removed;
+	}
+
+	/**
+         * @brief Deletes every element equal to a value.
+         * @param value The value to be removed.
+         * @return The number of deleted elements.
+         */
+	size_t remove(const T& value)
+	{
+		return erase_if([&value](const T& x) { return x == value; });
+	}
+
+	/* Append functions */
+	/**
+         * @brief Moves every element of another list to the end of this one.
+         *
+         * Takes over the node array of @p other in O(1) if this list is
+         * empty, and copies the elements over in O(m) otherwise.
+         *
+         * @param other The list to take the elements from, left empty.
+         */
+	void append(CompactLinkedList&& other)
+	{
+		if (&other == this) {
+			return;
+		}
+		if (is_empty()) {
+			swap(other);
+		} else {
+			append(other.begin(), other.end());
+		}
+		other.clear();
+	}
+
+	/**
+         * @brief Adds the elements of a range at the end of the list.
+         *
+         * The new nodes are linked to each other and hooked onto the end of
+         * the list in one step. If copying an element throws, the nodes
+         * made so far are freed and the list is left unchanged.
+         *
+         * @param first Input iterator to the first element to add.
+         * @param last Input iterator past the last element to add.
+         */
+	template <typename InputIt>
+	void append(InputIt first, InputIt last)
+	{
+		size_t n = 0;
+		uint32_t chain = new_chain(first, last, n);
+		if (n == 0) {
+			return;
+		}
+		uint32_t end = nodes[chain].prev;
+		nodes[chain].prev = tail;
+		if (tail == npos) {
+			head = chain;
+		} else {
+			nodes[tail].next = chain;
+		}
+		tail = end;
+		size += n;
+	}
+
+	/**
+         * @brief Splits the list in two at a cursor.
+         *
+         * The elements from @p pos to the end are copied into a new list
+         * and deleted from this one, in O(k) time.
+         *
+         * @param pos Cursor into this list.
+         * @return A list holding the elements from @p pos on.
+         */
+	CompactLinkedList split_at(Cursor pos)
+	{
+		CompactLinkedList rest;
+		rest.append(const_iterator(this, pos.cur), cend());
+		while (pos.cur != npos) {
+			uint32_t next = nodes[pos.cur].next;
+			unlink(pos.cur);
+			pos.cur = next;
+		}
+		return rest;
+	}
+
+	/* Sorting functions */
+	/**
+         * @brief Sorts the list, keeping equal elements in their order.
+         *
+         * The bottom-up merge sort of @ref DoublyLinkedList::sort(), relinking
+         * indices instead of pointers, so no element is copied and nothing
+         * is allocated. Takes O(n log n) time.
+         *
+         * @param comp Strict weak ordering of the elements.
+         */
+	template <typename Compare = std::less<T>>
+	void sort(Compare comp = Compare())
+	{
+		if (size < 2) {
+			return;
+		}
+		uint32_t bins[64];
+		for (size_t i = 0; i < 64; i++) {
+			bins[i] = npos;
+		}
+		size_t used = 0;
+		uint32_t p = head;
+		while (p != npos) {
+			uint32_t carry = p;
+			p = nodes[p].next;
+			nodes[carry].next = npos;
+			size_t i = 0;
+			for (; bins[i] != npos; i++) {
+				carry = merge_chains(bins[i], carry, comp);
+				bins[i] = npos;
+			}
+			bins[i] = carry;
+			if (i == used) {
+				used++;
+			}
+		}
+		uint32_t sorted = npos;
+		for (size_t i = 0; i < used; i++) {
+			if (bins[i] != npos) {
+				sorted = merge_chains(bins[i], sorted, comp);
+			}
+		}
+		relink(sorted);
+	}
+
+	/**
+         * @brief Merges another sorted list into this sorted one.
+         *
+         * The elements of @p other are copied into this list's array and
+         * the nodes are then relinked in O(n + m) time, elements of this
+         * list coming before equal ones of @p other. If copying throws,
+         * both lists are left unchanged.
+         *
+         * @param other A list sorted by @p comp, left empty.
+         * @param comp Strict weak ordering both lists are sorted by.
+         */
+	template <typename Compare = std::less<T>>
+	void merge(CompactLinkedList& other, Compare comp = Compare())
+	{
+		if (&other == this || other.is_empty()) {
+			return;
+		}
+		size_t n = 0;
+		uint32_t b = new_chain(other.cbegin(), other.cend(), n);
+		relink(merge_chains(head, b, comp));
+		size += n;
+		other.clear();
+	}
+
+	/* Iterator functions */
+	/** @brief Iterator to the first element. */
+	iterator begin() { return iterator(this, head); }
+
+	/** @brief Iterator past the last element. */
+	iterator end() { return iterator(this, npos); }
+
+	/** @brief Const iterator to the first element. */
+	const_iterator begin() const { return const_iterator(this, head); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator end() const { return const_iterator(this, npos); }
+
+	/** @brief Const iterator to the first element. */
+	const_iterator cbegin() const { return begin(); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator cend() const { return end(); }
+
+	/**
+         * @brief Get a cursor at the first element, for editing the list
+         *        while walking it.
+         * @return A cursor at the first element, or at the end if the list
+         *         is empty.
+         */
+	Cursor cursor() { return Cursor(this, head); }
+
+	/**
+         * @brief Get a cursor past the last element, where
+         *        @ref Cursor::insert_before() appends.
+         * @return A cursor at the end.
+         */
+	Cursor end_cursor() { return Cursor(this, npos); }
+
+	/* Utility functions */
+	/**
+         * @brief Makes room for a number of elements without reallocating.
+         * @param n The number of elements to hold storage for.
+         */
+	void reserve(size_t n)
+	{
+		if (n > max_size) {
+			throw std::length_error(
+				"CompactLinkedList is too large");
+		}
+		if (n > nodes.get_capacity()) {
+			nodes.resize(int(n));
+		}
+	}
+
+	/**
+         * @brief Exchanges the elements of two lists in O(1).
+         * @param other The list to swap with.
+         */
+	void swap(CompactLinkedList& other) noexcept
+	{
+		nodes.swap(other.nodes);
+		std::swap(head, other.head);
+		std::swap(tail, other.tail);
+		std::swap(free_head, other.free_head);
+		std::swap(size, other.size);
+	}
+
+	/**
+         * @brief Deletes every node in the list and frees the node array.
+         */
+	void clear()
+	{
+		CompactLinkedList empty;
+		swap(empty);
+	}
+
+	/**
+         * @brief Get the current size of the list.
+         * @return Current size of the list.
+         */
+	size_t get_size() const { return size; }
+
+	/**
+         * @brief Get the number of nodes the list holds storage for.
+         * @return Capacity of the node array.
+         */
+	size_t get_capacity() const { return nodes.get_capacity(); }
+
+	/**
+         * @brief Check if the list is empty.
+         * @return true if the list contains no elements, false otherwise.
+         */
+	bool is_empty() const { return size == 0; }
+
+	/**
+         * @brief Display the values in the nodes of the list.
+         */
+	void display() const
+	{
+		std::cout << "Size = " << size << '\n';
+		for (uint32_t p = head; p != npos; p = nodes[p].next) {
+			std::cout << nodes[p].data << " <-> ";
+		}
+		std::cout << "npos" << '\n';
+		std::cout << '\n';
+	}
+
+private:
+	/** Index standing for no node, ending the chains. */
+	static const uint32_t npos = UINT32_MAX;
+	/** Largest number of nodes the node array can hold. */
+	static const size_t max_size = INT32_MAX;
+
+	/** @brief Struct representing a node in the node array. */
+	struct Node {
+		/** Data contained in the node. */
+		T data;
+		/** Index of the previous node. */
+		uint32_t prev;
+		/** Index of the next node, or of the next free node. */
+		uint32_t next;
+
+		Node() : data(), prev(npos), next(npos) {}
+	};
+
+	/** All nodes, in use or on the free list. */
+	DynamicArray<Node> nodes;
+	/** Index of the first node. */
+	uint32_t head;
+	/** Index of the last node. */
+	uint32_t tail;
+	/** Index of the first free node. */
+	uint32_t free_head;
+	/** Current number of elements. */
+	size_t size;
+
+	/**
+         * @brief Takes a node off the free list, or appends one to the node
+         *        array if the free list is empty.
+         *
+         * @p data may be an element of this list, so it is copied before
+         * the node array grows. If copying it throws, a node taken off the
+         * free list goes back onto it.
+         * @param data The data of the node.
+         * @return Index of the unlinked node.
+         * @throws std::length_error when the links cannot address another
+         *         node.
+         */
+	uint32_t new_node(const T& data)
+	{
+		uint32_t x = free_head;
+		if (x == npos) {
+			if (nodes.get_size() == max_size) {
+				throw std::length_error(
+					"CompactLinkedList is too large");
+			}
+			Node node;
+			node.data = data;
+			nodes.add_last(node);
+			return uint32_t(nodes.get_size() - 1);
+		}
+		free_head = nodes[x].next;
+		try {
+			nodes[x].data = data;
+		} catch (...) {
+			nodes[x].next = free_head;
+			free_head = x;
+			throw;
+		}
+		return x;
+	}
+
+	/** @brief Links node @p x in between @p prev and @p next. */
+	void link_between(uint32_t prev, uint32_t x, uint32_t next)
+	{
+		nodes[x].prev = prev;
+		nodes[x].next = next;
+		if (prev == npos) {
+			head = x;
+		} else {
+			nodes[prev].next = x;
+		}
+		if (next == npos) {
+			tail = x;
+		} else {
+			nodes[next].prev = x;
+		}
+		size++;
+	}
+
+	/**
+         * @brief Unlinks node @p x and puts it onto the free list.
+         * @return The data the node held.
+         */
+	T unlink(uint32_t x)
+	{
+		Node& n = nodes[x];
+		if (n.prev == npos) {
+			head = n.next;
+		} else {
+			nodes[n.prev].next = n.next;
+		}
+		if (n.next == npos) {
+			tail = n.prev;
+		} else {
+			nodes[n.next].prev = n.prev;
+		}
+		T data = std::move(n.data);
+		free_node(x);
+		size--;
+		return data;
+	}
+
+	/** @brief Puts the unlinked node @p x onto the free list. */
+	void free_node(uint32_t x)
+	{
+		nodes[x].data = T();
+		nodes[x].next = free_head;
+		free_head = x;
+	}
+
+	/**
+         * @brief Copies a range into new nodes linked only to each other.
+         *
+         * The prev link of the first node is left pointing at the last one.
+         * If copying an element throws, the nodes made so far are freed.
+         *
+         * @param n Receives the number of nodes made.
+         * @return Index of the first node, npos for an empty range.
+         */
+	template <typename InputIt>
+	uint32_t new_chain(InputIt first, InputIt last, size_t& n)
+	{
+		uint32_t chain = npos;
+		uint32_t end = npos;
+		try {
+			for (; first != last; ++first) {
+				uint32_t x = new_node(*first);
+				nodes[x].prev = end;
+				nodes[x].next = npos;
+				if (end == npos) {
+					chain = x;
+				} else {
+					nodes[end].next = x;
+				}
+				end = x;
+				n++;
+			}
+		} catch (...) {
+			while (end != npos) {
+				uint32_t prev = nodes[end].prev;
+				free_node(end);
+				end = prev;
+			}
+			n = 0;
+			throw;
+		}
+		if (chain != npos) {
+			nodes[chain].prev = end;
+		}
+		return chain;
+	}
+
+	/**
+         * @brief Merges two sorted chains linked through their next links
+         *        only, taking from @p a first on ties.
+         * @return Index of the first node of the merged chain.
+         */
+	template <typename Compare>
+	uint32_t merge_chains(uint32_t a, uint32_t b, Compare& comp)
+	{
+		uint32_t first = npos;
+		uint32_t last = npos;
+		while (a != npos && b != npos) {
+			uint32_t x;
+			if (comp(nodes[b].data, nodes[a].data)) {
+				x = b;
+				b = nodes[b].next;
+			} else {
+				x = a;
+				a = nodes[a].next;
+			}
+			if (last == npos) {
+				first = x;
+			} else {
+				nodes[last].next = x;
+			}
+			last = x;
+		}
+		uint32_t rest = a != npos ? a : b;
+		if (last == npos) {
+			return rest;
+		}
+		nodes[last].next = rest;
+		return first;
+	}
+
+	/**
+         * @brief Makes the chain starting at @p first the whole list,
+         *        restoring the prev links and the ends.
+         */
+	void relink(uint32_t first)
+	{
+		uint32_t prev = npos;
+		for (uint32_t p = first; p != npos; p = nodes[p].next) {
+			nodes[p].prev = prev;
+			prev = p;
+		}
+		head = first;
+		tail = prev;
+	}
+
+	/**
+         * @brief Get the index of the requested node, walking from the
+         *        nearer end.
+         * @param index Index of the desired element.
+         * @return Index of its node in the node array.
+         */
+	uint32_t get_node(int index) const
+	{
+		check_element_index(index);
+		uint32_t p;
+		if (index < int(size) / 2) {
+			p = head;
+			for (int i = 0; i < index; i++) {
+				p = nodes[p].next;
+			}
+		} else {
+			p = tail;
+			for (int i = int(size) - 1; i > index; i--) {
+				p = nodes[p].prev;
+			}
+		}
+		return p;
+	}
+
+	/**
+         * @brief Checks the given index and throws an exception if out of
+         *        range i.e not in [0, size).
+         * @param index Index to be checked.
+         */
+	void check_element_index(int index) const
+	{
+		if (index < 0 || index >= int(size)) {
+			throw std::out_of_range(
+				"Element Index: " + std::to_string(index) +
+				", Size: " + std::to_string(size));
+		}
+	}
+
+	/**
+         * @brief Checks the given position and throws an exception if out of
+         *        range i.e not in [0, size].
+         * @param pos_index Position index to be checked.
+         */
+	void check_position_index(int pos_index) const
+	{
+		if (pos_index < 0 || pos_index > int(size)) {
+			throw std::out_of_range(
+				"Position Index: " + std::to_string(pos_index) +
+				", Size: " + std::to_string(size));
+		}
+	}
+};
+
+/**
+ * @brief Bidirectional iterator over a CompactLinkedList.
+ */
+template <typename T>
+template <bool IsConst>
+class CompactLinkedList<T>::Iterator {
+	typedef typename std::conditional<IsConst, const CompactLinkedList,
+					  CompactLinkedList>::type List;
+
+public:
+	typedef std::bidirectional_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+	typedef typename std::conditional<IsConst, const T&, T&>::type
+		reference;
+
+	Iterator() : list(nullptr), cur(npos) {}
+
+	Iterator(List* l, uint32_t i) : list(l), cur(i) {}
+
+	// Allows an iterator to be passed where a const_iterator is expected.
+	template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+	Iterator(const Iterator<false>& other)
+		: list(other.list), cur(other.cur)
+	{
+	}
+
+	reference operator*() const { return list->nodes[cur].data; }
+
+	pointer operator->() const { return &list->nodes[cur].data; }
+
+	Iterator& operator++()
+	{
+		cur = list->nodes[cur].next;
+		return *this;
+	}
+
+	Iterator operator++(int)
+	{
+		Iterator old = *this;
+		++*this;
+		return old;
+	}
+
+	Iterator& operator--()
+	{
+		cur = cur == npos ? list->tail : list->nodes[cur].prev;
+		return *this;
+	}
+
+	Iterator operator--(int)
+	{
+		Iterator old = *this;
+		--*this;
+		return old;
+	}
+
+	bool operator==(const Iterator& other) const
+	{
+		return cur == other.cur;
+	}
+
+	bool operator!=(const Iterator& other) const
+	{
+		return cur != other.cur;
+	}
+
+private:
+	friend class Iterator<!IsConst>;
+
+	List* list;
+	uint32_t cur;
+};
+
+/**
+ * @class CompactLinkedList::Cursor
+ * @brief Position in a CompactLinkedList at which elements can be inserted
+ *        and erased in O(1).
+ *
+ * The cursor holds the index of its current element, so it stays valid
+ * across the node array growing and across any edit that does not delete
+ * that element.
+ */
+template <typename T>
+class CompactLinkedList<T>::Cursor {
+public:
+	/**
+         * @brief Check if the cursor is past the last element.
+         * @return true if there is no current element.
+         */
+	bool is_end() const { return cur == npos; }
+
+	/**
+         * @brief Get the current element.
+         * @return Reference to the current element, invalidated when the
+         *         node array grows.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	T& get() const
+	{
+		check_not_end();
+		return list->nodes[cur].data;
+	}
+
+	/**
+         * @brief Moves the cursor to the next element.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	void advance()
+	{
+		check_not_end();
+		cur = list->nodes[cur].next;
+	}
+
+	/**
+         * @brief Moves the cursor to the previous element.
+         * @throws std::out_of_range if the cursor is at the first element.
+         */
+	void retreat()
+	{
+		uint32_t prev =
+			cur == npos ? list->tail : list->nodes[cur].prev;
+		if (prev == npos) {
+			throw std::out_of_range(
+				"Cursor is at the first element");
+		}
+		cur = prev;
+	}
+
+	/**
+         * @brief Inserts an element before the current one, the cursor
+         *        staying on the current element. At the end, this appends.
+         * @param data The element to be inserted.
+         */
+	void insert_before(const T& data)
+	{
+		uint32_t x = list->new_node(data);
+		uint32_t prev =
+			cur == npos ? list->tail : list->nodes[cur].prev;
+		list->link_between(prev, x, cur);
+	}
+
+	/**
+         * @brief Inserts an element after the current one, the cursor
+         *        staying on the current element.
+         * @param data The element to be inserted.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	void insert_after(const T& data)
+	{
+		check_not_end();
+		uint32_t x = list->new_node(data);
+		list->link_between(cur, x, list->nodes[cur].next);
+	}
+
+	/**
+         * @brief Deletes the current element, moving the cursor to the
+         *        next one.
+         * @return The deleted element.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	T erase()
+	{
+		check_not_end();
+		uint32_t x = cur;
+		cur = list->nodes[cur].next;
+		return list->unlink(x);
+	}
+
+private:
+	friend class CompactLinkedList;
+
+	/** The list the cursor walks. */
+	CompactLinkedList* list;
+	/** Index of the node of the current element, npos at the end. */
+	uint32_t cur;
+
+	Cursor(CompactLinkedList* l, uint32_t i) : list(l), cur(i) {}
+
+	void check_not_end() const
+	{
+		if (is_end()) {
+			throw std::out_of_range(
+				"Cursor is past the last element");
+		}
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_COMPACT_LINKED_LIST_H
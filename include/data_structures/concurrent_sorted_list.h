@@ -0,0 +1,273 @@
+#ifndef DATA_STRUCTURES_CONCURRENT_SORTED_LIST_H
+#define DATA_STRUCTURES_CONCURRENT_SORTED_LIST_H
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+#include "epoch_reclaimer.h"
+
+namespace DataStructures {
+
+/**
+ * @class ConcurrentSortedList
+ * @brief Sorted set as a singly linked list with lazy synchronization, for
+ *        concurrent lookups, inserts and removals.
+ *
+ * Follows the lazy list of Heller, Herlihy, Luchangco, Moir, Scherer and
+ * Shavit. Every node has its own lock and a deletion mark:
+ *
+ * - @ref contains() takes no locks and never retries, it walks the list
+ *   once and reports a key found in an unmarked node, so it is wait-free.
+ * - @ref add() and @ref remove() first search without locking, then lock
+ *   only the two nodes around the key and validate that neither is marked
+ *   and that they are still adjacent, starting over otherwise.
+ * - A removal first marks the node, which takes it out of the set, and
+ *   then unlinks it. Readers already standing on it can still walk on.
+ *
+ * Unlinked nodes are handed to the @ref EpochReclaimer, and every
+ * operation runs inside an epoch guard, so a node is freed only once no
+ * thread can still be reading or waiting for its lock.
+ *
+ * @tparam T Type of the keys, copyable.
+ * @tparam Compare Strict weak ordering of the keys.
+ */
+template <typename T, typename Compare = std::less<T>>
+class ConcurrentSortedList {
+public:
+	/**
+         * @brief Constructor for an empty ConcurrentSortedList.
+         * @param compare The ordering of the keys.
+         */
+	explicit ConcurrentSortedList(const Compare& compare = Compare())
+		: comp(compare), size(0)
+	{
+	}
+
+	/**
+         * @brief Destructor for the ConcurrentSortedList class.
+         *
+         * Deletes the remaining nodes. No thread may be using the list
+         * anymore.
+         */
+	~ConcurrentSortedList()
+	{
+		Node* p = head.next.load(std::memory_order_relaxed);
+		while (p != nullptr) {
+			Node* next = p->next.load(std::memory_order_relaxed);
+			delete p;
+			p = next;
+		}
+	}
+
+	ConcurrentSortedList(const ConcurrentSortedList&) = delete;
+	ConcurrentSortedList& operator=(const ConcurrentSortedList&) = delete;
+
+	/**
+         * @brief Adds a key unless it is in the set already.
+         * @param key The key.
+         * @return true if the key was added, false if it was present.
+         */
+	bool add(const T& key)
+	{
+		EpochReclaimer::Guard guard;
+		for (;;) {
+			Link* pred;
+			Node* curr;
+			search(key, pred, curr);
+			Locks locks(pred, curr);
+			if (!validate(pred, curr)) {
+				continue;
+			}
+			if (curr != nullptr && !comp(key, curr->key)) {
+				return false;
+			}
+			pred->next.store(new Node(key, curr),
+					 std::memory_order_release);
+			size.fetch_add(1, std::memory_order_relaxed);
+			return true;
+		}
+	}
+
+	/**
+         * @brief Removes a key from the set.
+         * @param key The key.
+         * @return true if the key was removed, false if it was absent.
+         */
+	bool remove(const T& key)
+	{
+		EpochReclaimer::Guard guard;
+		for (;;) {
+			Link* pred;
+			Node* curr;
+			search(key, pred, curr);
+			{
+				Locks locks(pred, curr);
+				if (!validate(pred, curr)) {
+					continue;
+				}
+				if (curr == nullptr || comp(key, curr->key)) {
+					return false;
+				}
+				curr->marked.store(true,
+						   std::memory_order_release);
+				unlink(pred, curr);
+			}
+			size.fetch_sub(1, std::memory_order_relaxed);
+			EpochReclaimer::retire(curr);
+			return true;
+		}
+	}
+
+	/**
+         * @brief Checks if a key is in the set, without taking any lock.
+         * @param key The key.
+         * @return true if the key was present at some point of the call.
+         */
+	bool contains(const T& key) const
+	{
+		EpochReclaimer::Guard guard;
+		Node* curr = head.next.load(std::memory_order_acquire);
+		while (curr != nullptr && comp(curr->key, key)) {
+			curr = curr->next.load(std::memory_order_acquire);
+		}
+		return curr != nullptr && !comp(key, curr->key) &&
+		       !curr->marked.load(std::memory_order_acquire);
+	}
+
+	/**
+         * @brief Calls a function with every key in ascending order.
+         *
+         * The walk takes no locks, so it is not a snapshot: keys added or
+         * removed meanwhile may or may not be visited, but every key
+         * present throughout the call is visited exactly once.
+         *
+         * @param fn Function called with every key.
+         */
+	template <typename Function>
+	void for_each(Function fn) const
+	{
+		EpochReclaimer::Guard guard;
+		Node* curr = head.next.load(std::memory_order_acquire);
+		while (curr != nullptr) {
+			if (!curr->marked.load(std::memory_order_acquire)) {
+				fn(static_cast<const T&>(curr->key));
+			}
+			curr = curr->next.load(std::memory_order_acquire);
+		}
+	}
+
+	/**
+         * @brief Get the number of keys in the set.
+         * @return The number of keys, exact only while no thread modifies
+         *         the list.
+         */
+	size_t get_size() const
+	{
+		return size.load(std::memory_order_relaxed);
+	}
+
+	/**
+         * @brief Check if the set is empty.
+         * @return true if the list had no keys at the time of the call.
+         */
+	bool is_empty() const
+	{
+		return head.next.load(std::memory_order_acquire) == nullptr;
+	}
+
+private:
+	struct Node;
+
+	/** @brief Successor, lock and mark shared by the nodes and the head. */
+	struct Link {
+		/** Next node, written only under the lock of this node. */
+		std::atomic<Node*> next;
+		/** Set once the node is logically deleted, never cleared. */
+		std::atomic<bool> marked;
+		/** Taken by writers changing or validating the successor. */
+		std::mutex lock;
+
+		explicit Link(Node* n = nullptr) : next(n), marked(false) {}
+	};
+
+	/** @brief Struct representing a node holding a key. */
+	struct Node : Link {
+		/** The key, immutable once linked. */
+		const T key;
+
+		Node(const T& k, Node* n) : Link(n), key(k) {}
+	};
+
+	Compare comp;
+	/** Sentinel before the smallest key, never marked. */
+	Link head;
+	/** Number of keys. */
+	std::atomic<size_t> size;
+
+	/**
+         * @brief Finds the last link before @p key and the node after it,
+         *        the first one whose key is not less than @p key, or
+         *        nullptr.
+         */
+	void search(const T& key, Link*& pred, Node*& curr)
+	{
+		pred = &head;
+		curr = head.next.load(std::memory_order_acquire);
+		while (curr != nullptr && comp(curr->key, key)) {
+			pred = curr;
+			curr = curr->next.load(std::memory_order_acquire);
+		}
+	}
+
+	/**
+         * @brief Checks, with the locks of @p pred and @p curr held, that
+         *        both are still in the list and adjacent.
+         */
+	static bool validate(Link* pred, Node* curr)
+	{
+		return !pred->marked.load(std::memory_order_relaxed) &&
+		       (curr == nullptr ||
+			!curr->marked.load(std::memory_order_relaxed)) &&
+		       pred->next.load(std::memory_order_relaxed) == curr;
+	}
+
+	/** @brief Unlinks @p curr, with its lock and that of @p pred held. */
+	static void unlink(Link* pred, Node* curr)
+	{
+		Node* next = curr->next.load(std::memory_order_relaxed);
+		pred->next.store(next, std::memory_order_release);
+	}
+
+	/** @brief Holds the locks of @p pred and, unless null, @p curr. */
+	class Locks {
+	public:
+		Locks(Link* pred, Node* curr) : first(pred), second(curr)
+		{
+			first->lock.lock();
+			if (second != nullptr) {
+				second->lock.lock();
+			}
+		}
+
+		~Locks()
+		{
+			if (second != nullptr) {
+				second->lock.unlock();
+			}
+			first->lock.unlock();
+		}
+
+		Locks(const Locks&) = delete;
+		Locks& operator=(const Locks&) = delete;
+
+	private:
+		Link* first;
+		Node* second;
+	};
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_CONCURRENT_SORTED_LIST_H
@@ -0,0 +1,178 @@
+#ifndef DATA_STRUCTURES_DEQUE_H
+#define DATA_STRUCTURES_DEQUE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "backend_traits.h"
+#include "circular_array.h"
+
+namespace DataStructures {
+
+/**
+ * @class Deque
+ * @brief Deque adapter over any container described by @ref BackendTraits.
+ *
+ * The backend must add and delete at both of its ends in O(1), which is
+ * checked at compile time. Deleting checks for an empty deque once and then
+ * uses the single removing operation of the backend.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Container The backend container.
+ */
+template <typename T, typename Container = CircularArray<T>>
+class Deque {
+	typedef BackendTraits<Container> Traits;
+
+	static_assert(std::is_same<typename Traits::value_type, T>::value,
+		      "Deque backend must hold elements of type T");
+	static_assert(Traits::fast_add_first && Traits::fast_add_last &&
+			      Traits::fast_del_first && Traits::fast_del_last,
+		      "Deque backend must add and delete at both ends in O(1)");
+
+public:
+	/**
+         * @brief Add an element at the front of the deque.
+         * @param element The element to be added.
+         */
+	void add_first(const T& element) { Traits::add_first(c, element); }
+
+	/**
+         * @brief Add an element at the back of the deque.
+         * @param element The element to be added.
+         */
+	void add_last(const T& element) { Traits::add_last(c, element); }
+
+	/**
+         * @brief Delete the element at the front of the deque.
+         * @return The value of the deleted element.
+         * @throws std::out_of_range if the deque is empty.
+         */
+	T del_first()
+	{
+		if (Traits::empty(c)) {
+			throw std::out_of_range("Deque is empty");
+		}
+		return Traits::del_first(c);
+	}
+
+	/**
+         * @brief Delete the element at the back of the deque.
+         * @return The value of the deleted element.
+         * @throws std::out_of_range if the deque is empty.
+         */
+	T del_last()
+	{
+		if (Traits::empty(c)) {
+			throw std::out_of_range("Deque is empty");
+		}
+		return Traits::del_last(c);
+	}
+
+	/**
+         * @brief Get the value of the element at the front of the deque.
+         * @return The value of the element at the front.
+         * @throws std::out_of_range if the deque is empty.
+         */
+	T peek_first() const
+	{
+		if (Traits::empty(c)) {
+			throw std::out_of_range("Deque is empty");
+		}
+		return Traits::get_first(c);
+	}
+
+	/**
+         * @brief Get the value of the element at the back of the deque.
+         * @return The value of the element at the back.
+         * @throws std::out_of_range if the deque is empty.
+         */
+	T peek_last() const
+	{
+		if (Traits::empty(c)) {
+			throw std::out_of_range("Deque is empty");
+		}
+		return Traits::get_last(c);
+	}
+
+	/**
+         * @brief Get the current size of the deque.
+         * @return The current size of the deque.
+         */
+	size_t size() const { return Traits::size(c); }
+
+	/**
+         * @brief Check if the deque is empty.
+         * @return true if the deque has no elements, false otherwise.
+         */
+	bool is_empty() const { return Traits::empty(c); }
+
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (Traits::empty(c)) {
+			return false;
+		}
+		out = Traits::del_first(c);
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (Traits::empty(c)) {
+			return false;
+		}
+		out = Traits::del_last(c);
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_peek_first(T& out) const
+	{
+		if (Traits::empty(c)) {
+			return false;
+		}
+		out = Traits::get_first(c);
+		return true;
+	}
+
+	/**
+         * @brief Get the last element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_peek_last(T& out) const
+	{
+		if (Traits::empty(c)) {
+			return false;
+		}
+		out = Traits::get_last(c);
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two deques in O(1).
+         * @param other The deque to swap with.
+         */
+	void swap(Deque& other) noexcept { c.swap(other.c); }
+
+private:
+	/**
+         * The container used to internally implement the deque.
+         */
+	Container c;
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_DEQUE_H
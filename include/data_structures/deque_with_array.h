@@ -13,6 +13,11 @@ namespace DataStructures {
 template <typename T>
 class DequeWithArray {
 public:
+	/** Random access iterator over the deque from front to back. */
+	typedef typename CircularArray<T>::iterator iterator;
+	/** Read-only random access iterator over the deque. */
+	typedef typename CircularArray<T>::const_iterator const_iterator;
+
 	/**
          * @brief Adds an element to the front of the deque.
          * @param element The element to be added.
@@ -49,6 +54,134 @@ public:
          */
 	T peek_last() const { return arr.get_last(); }
 
+	/**
+         * @brief Gets the value of the element at a given distance from the
+         *        front of the deque.
+         * @param index Index of the element, zero being the front.
+         * @return The value of the element.
+         * @throws std::out_of_range if the index is not in [0, size).
+         */
+	T get(int index) const { return arr.get(index); }
+
+	/**
+         * @brief Unchecked access to the element at a given distance from the
+         *        front of the deque.
+         * @param index Index of the element, zero being the front.
+         * @return Reference to the element.
+         */
+	T& operator[](size_t index) { return arr[index]; }
+
+	/**
+         * @brief Unchecked read-only access to the element at a given distance
+         *        from the front of the deque.
+         * @param index Index of the element, zero being the front.
+         * @return Reference to the element.
+         */
+	const T& operator[](size_t index) const { return arr[index]; }
+
+	/** @brief Iterator to the front of the deque. */
+	iterator begin() { return arr.begin(); }
+
+	/** @brief Iterator past the back of the deque. */
+	iterator end() { return arr.end(); }
+
+	/** @brief Read-only iterator to the front of the deque. */
+	const_iterator begin() const { return arr.begin(); }
+
+	/** @brief Read-only iterator past the back of the deque. */
+	const_iterator end() const { return arr.end(); }
+
+	/** @brief Read-only iterator to the front of the deque. */
+	const_iterator cbegin() const { return arr.cbegin(); }
+
+	/** @brief Read-only iterator past the back of the deque. */
+	const_iterator cend() const { return arr.cend(); }
+
+	/**
+         * @brief Gets the contents of the deque as two contiguous runs.
+         *
+         * The first span starts at the front of the deque, the second one
+         * continues where the first ends and is empty unless the underlying
+         * circular array has wrapped around.
+         *
+         * @return The pair of spans covering the deque from front to back.
+         */
+	std::pair<Span<T>, Span<T>> segments() { return arr.segments(); }
+
+	/**
+         * @brief Gets the contents of the deque as two read-only contiguous
+         *        runs.
+         * @return The pair of spans covering the deque from front to back.
+         */
+	std::pair<Span<const T>, Span<const T>> segments() const
+	{
+		return arr.segments();
+	}
+
+	/**
+         * @brief Gets the current size of the deque.
+         * @return The current size of the deque.
+         */
+	size_t size() const { return arr.get_size(); }
+
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (arr.is_empty()) {
+			return false;
+		}
+		out = arr.del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (arr.is_empty()) {
+			return false;
+		}
+		out = arr.del_last();
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_peek_first(T& out) const
+	{
+		if (arr.is_empty()) {
+			return false;
+		}
+		out = arr.get_first();
+		return true;
+	}
+
+	/**
+         * @brief Get the last element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_peek_last(T& out) const
+	{
+		if (arr.is_empty()) {
+			return false;
+		}
+		out = arr.get_last();
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two deques in O(1).
+         * @param other The deque to swap with.
+         */
+	void swap(DequeWithArray& other) noexcept { arr.swap(other.arr); }
+
 private:
 	/** The circular array used to internally implement the deque. */
 	CircularArray<T> arr;
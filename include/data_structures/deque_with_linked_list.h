@@ -59,6 +59,67 @@ public:
          */
 	T peek_last() const { return list.get_last(); }
 
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (list.is_empty()) {
+			return false;
+		}
+		out = list.del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (list.is_empty()) {
+			return false;
+		}
+		out = list.del_last();
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_peek_first(T& out) const
+	{
+		if (list.is_empty()) {
+			return false;
+		}
+		out = list.get_first();
+		return true;
+	}
+
+	/**
+         * @brief Get the last element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_peek_last(T& out) const
+	{
+		if (list.is_empty()) {
+			return false;
+		}
+		out = list.get_last();
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two deques in O(1).
+         * @param other The deque to swap with.
+         */
+	void swap(DequeWithLinkedList& other) noexcept
+	{
+		list.swap(other.list);
+	}
+
 private:
 	/** The doubly linked list used to internally implement the deque. */
 	DoublyLinkedList<T> list;
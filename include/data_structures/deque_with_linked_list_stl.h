@@ -2,6 +2,7 @@
 #define DATA_STRUCTURES_DEQUE_WITH_LINKED_LIST_STL_H
 
 #include <list>
+#include <utility>
 
 namespace DataStructures {
 
@@ -80,6 +81,69 @@ public:
 		return list.back();
 	}
 
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (list.empty()) {
+			return false;
+		}
+		out = std::move(list.front());
+		list.pop_front();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (list.empty()) {
+			return false;
+		}
+		out = std::move(list.back());
+		list.pop_back();
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_peek_first(T& out) const
+	{
+		if (list.empty()) {
+			return false;
+		}
+		out = list.front();
+		return true;
+	}
+
+	/**
+         * @brief Get the last element into @p out if there is one.
+         * @return false if the deque was empty.
+         */
+	bool try_peek_last(T& out) const
+	{
+		if (list.empty()) {
+			return false;
+		}
+		out = list.back();
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two deques in O(1).
+         * @param other The deque to swap with.
+         */
+	void swap(DequeWithLinkedListSTL& other) noexcept
+	{
+		list.swap(other.list);
+	}
+
 private:
 	/** The doubly linked list used to internally implement the deque. */
 	std::list<T> list;
@@ -3,86 +3,134 @@
 #ifndef DATA_STRUCTURES_DOUBLY_LINKED_LIST_H
 #define DATA_STRUCTURES_DOUBLY_LINKED_LIST_H
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "node_pool.h"
 
 namespace DataStructures {
 
 /**
  * @class DoublyLinkedList
  * @brief Doubly linked list class with all related functionality.
+ *
+ * Nodes are allocated from a @ref NodePool, created along with the first
+ * node, which can also be shared with other lists of the same type.
+ *
  * @tparam T Type of the implementation class.
  */
 template <typename T>
 class DoublyLinkedList {
+	struct Node;
+
+	template <bool IsConst>
+	class Iterator;
+
 public:
+	class Cursor;
+
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+
+	/** @brief Type of the pool the nodes are allocated from. */
+	typedef NodePool<Node> Pool;
+
 	/**
          * @brief Constructor for the DoublyLinkedList class.
          *
-         * Initializes the head and tail pointers by linking them to each other.
+         * Links the sentinel embedded in the list to itself, so an empty list
+         * allocates nothing and @p T need not be default constructible.
          */
-	DoublyLinkedList()
+	DoublyLinkedList() noexcept : size(0) { root.prev = root.next = &root; }
+
+	/**
+         * @brief Constructor for a DoublyLinkedList allocating its nodes from
+         *        a given pool.
+         * @param node_pool The pool, possibly shared with other lists.
+         */
+	explicit DoublyLinkedList(std::shared_ptr<Pool> node_pool)
+		: DoublyLinkedList()
 	{
-		head = new Node(T());
-		tail = new Node(T());
-		head->next = tail;
-		tail->prev = head;
-		size = 0;
+		pool = std::move(node_pool);
 	}
 
 	/**
-         * @brief Destructor for the DoublyLinkedList class.
-         *
-         * Clears the doubly linked list and deletes the head and tail 
-         * pointers.
+         * @brief Move constructor, taking over the nodes of another list in
+         *        O(1) and leaving it empty.
+         * @param other The list to move from.
          */
-	~DoublyLinkedList()
+	DoublyLinkedList(DoublyLinkedList&& other) noexcept : DoublyLinkedList()
 	{
-		while (size > 0) {
-			del_first();
-		}
-		delete head;
-		delete tail;
+		swap(other);
+	}
+
+	/**
+         * @brief Move assignment, freeing the current nodes and taking over
+         *        those of another list in O(1).
+         * @param other The list to move from, left empty.
+         * @return Reference to this list.
+         */
+	DoublyLinkedList& operator=(DoublyLinkedList&& other) noexcept
+	{
+		DoublyLinkedList old(std::move(other));
+		swap(old);
+		return *this;
 	}
 
+	/**
+         * @brief Destructor for the DoublyLinkedList class.
+         *
+         * Frees every element node.
+         */
+	~DoublyLinkedList() { release_nodes(); }
+
 	/* Insert functions */
 	/**
          * @brief Adds a new node at the start of the doubly linked list.
          *
-         * This is achieved by first linking the new node before the currently 
-         * first node and then consequently linking the head to this new start 
-         * node. The size of the doubly linked list is incremented by unity.
+         * This is achieved by first linking the new node before the currently
+         * first node and then consequently linking the sentinel to this new
+         * start node. The size of the doubly linked list is incremented by
+         * unity.
          *
          * @param data The data of the node.
          */
 	void add_first(const T& data)
 	{
-		Node* x = new Node(data);
-		Node* temp = head->next;
+		Node* x = new_node(data);
+		Link* temp = root.next;
 		temp->prev = x;
 		x->next = temp;
-		head->next = x;
-		x->prev = head;
+		root.next = x;
+		x->prev = &root;
 		size++;
 	}
 
 	/** 
          * @brief Adds a new node at the end of a doubly linked list.
          *
-         * This is achieved by first linking the new node after the currently 
-         * last node and then consequently linking the tail to this new end 
-         * node. The size of the doubly linked list is incremented by unity.
+         * This is achieved by first linking the new node after the currently
+         * last node and then consequently linking the sentinel to this new
+         * end node. The size of the doubly linked list is incremented by
+         * unity.
          *
          * @param data The data of the node.
          */
 	void add_last(const T& data)
 	{
-		Node* x = new Node(data);
-		Node* temp = tail->prev;
+		Node* x = new_node(data);
+		Link* temp = root.prev;
 		temp->next = x;
 		x->prev = temp;
-		x->next = tail;
-		tail->prev = x;
+		x->next = &root;
+		root.prev = x;
 		size++;
 	}
 
@@ -106,9 +154,9 @@ public:
 			add_last(data);
 			return;
 		}
-		Node* p = get_node(pos_index);
-		Node* temp = p->prev;
-		Node* x = new Node(data);
+		Link* p = get_node(pos_index);
+		Link* temp = p->prev;
+		Node* x = new_node(data);
 		temp->next = x;
 		x->prev = temp;
 		x->next = p;
@@ -120,10 +168,10 @@ public:
 	/**
          * @brief Delete the first node in the list.
          *
-         * This is achieved by first checking that the doubly linked list is 
-         * not empty and then linking the head to the next node after the first 
-         * node. Memory of the node is freed, the size is updated and its data
-         * returned.
+         * This is achieved by first checking that the doubly linked list is
+         * not empty and then linking the sentinel to the next node after the
+         * first node. Memory of the node is freed, the size is updated and
+         * its data returned.
          *
          * @return The data of the first node that will be deleted.
          */
@@ -132,12 +180,12 @@ public:
 		if (size == 0) {
 			throw std::out_of_range("No elements to remove");
 		}
-		Node* x = head->next;
-		Node* temp = x->next;
-		head->next = temp;
-		temp->prev = head;
-		T data = x->data;
-		delete x;
+		Link* x = root.next;
+		Link* temp = x->next;
+		root.next = temp;
+		temp->prev = &root;
+		T data = value(x);
+		pool->destroy(static_cast<Node*>(x));
 		size--;
 		return data;
 	}
@@ -145,9 +193,10 @@ public:
 	/** 
          * @brief Delete the last node in the list.
          *
-         * This is achieved by first checking that the doubly linked list is 
-         * not empty and then linking the second last node to the tail. Memory 
-         * of the node is freed, the size is updated and its data is returned.
+         * This is achieved by first checking that the doubly linked list is
+         * not empty and then linking the second last node to the sentinel.
+         * Memory of the node is freed, the size is updated and its data is
+         * returned.
          *
          * @return The data of the ending node that will be deleted.
          */
@@ -156,18 +205,68 @@ public:
 		if (size == 0) {
 			throw std::out_of_range("No elements to remove");
 		}
-		Node* x = tail->prev;
-		Node* temp = tail->prev->prev;
-		tail->prev = temp;
-		temp->next = tail;
-		T data = x->data;
-		x->prev = nullptr;
-		x->next = nullptr;
-		delete x;
+		Link* x = root.prev;
+		Link* temp = root.prev->prev;
+		root.prev = temp;
+		temp->next = &root;
+		T data = value(x);
+		pool->destroy(static_cast<Node*>(x));
 		size--;
 		return data;
 	}
 
+	/**
+         * @brief Deletes the last @p count elements at once.
+         *
+         * The nodes are freed walking back from the end, and the remaining
+         * list is closed off with a single relink.
+         *
+         * @param count The number of elements to delete.
+         * @throws std::out_of_range if the list has fewer elements.
+         */
+	void del_last_n(size_t count)
+	{
+		if (count > size) {
+			throw std::out_of_range(
+				"Not enough elements to remove");
+		}
+		Link* p = root.prev;
+		for (size_t i = 0; i < count; i++) {
+			Link* prev = p->prev;
+			pool->destroy(static_cast<Node*>(p));
+			p = prev;
+		}
+		p->next = &root;
+		root.prev = p;
+		size -= count;
+	}
+
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_last();
+		return true;
+	}
+
 	/** 
          * @brief Delete a node at a particular index.
          *
@@ -181,15 +280,13 @@ public:
 	T del(int index)
 	{
 		check_element_index(index);
-		Node* x = get_node(index);
-		Node* prev = x->prev;
-		Node* next = x->next;
+		Link* x = get_node(index);
+		Link* prev = x->prev;
+		Link* next = x->next;
 		prev->next = next;
 		next->prev = prev;
-		T data = x->data;
-		x->prev = nullptr;
-		x->next = nullptr;
-		delete x;
+		T data = value(x);
+		pool->destroy(static_cast<Node*>(x));
 		size--;
 		return data;
 	}
@@ -210,7 +307,7 @@ public:
 		if (is_empty()) {
 			throw std::out_of_range("No nodes in the list");
 		}
-		return head->next->data;
+		return value(root.next);
 	}
 
 	/** 
@@ -228,7 +325,7 @@ public:
 		if (is_empty()) {
 			throw std::out_of_range("No nodes in the list");
 		}
-		return tail->prev->data;
+		return value(root.prev);
 	}
 
 	/**
@@ -242,8 +339,8 @@ public:
          */
 	T get(int index)
 	{
-		Node* p = get_node(index);
-		return p->data;
+		Link* p = get_node(index);
+		return value(p);
 	}
 
 	/* Set function */
@@ -258,13 +355,461 @@ public:
          */
 	T set(int index, T data)
 	{
-		Node* p = get_node(index);
-		T old_val = p->data;
-		p->data = data;
+		Link* p = get_node(index);
+		T old_val = value(p);
+		value(p) = data;
 		return old_val;
 	}
 
+	/* Bulk erase functions */
+	/**
+         * @brief Deletes every element satisfying a predicate.
+         *
+         * The list is traversed once, unlinking the matching nodes as they
+         * are found, so this takes O(n) time instead of the O(n^2) of
+         * calling @ref del() for every match.
+         *
+         * @param pred Predicate called with every element.
+         * @return The number of deleted elements.
+         */
+	template <typename Predicate>
+	size_t erase_if(Predicate pred)
+	{
+		size_t removed = 0;
+		Link* p = root.next;
+		while (p != &root) {
+			Link* next = p->next;
+			if (pred(value(p))) {
+				unlink(p);
+				removed++;
+			}
+			p = next;
+		}
+		return removed;
+	}
+
+	/**
+         * @brief Deletes every element equal to a value.
+         * @param value The value to be removed.
+         * @return The number of deleted elements.
+         */
+	size_t remove(const T& value)
+	{
+		return erase_if([&value](const T& x) { return x == value; });
+	}
+
+	/* Splice functions */
+	/**
+         * @brief Moves every element of another list to the end of this one.
+         *
+         * Only the links at the two ends are changed, so this takes O(1)
+         * time, see @ref splice() for the conditions.
+         *
+         * @param other The list to take the elements from, left empty.
+         */
+	void append(DoublyLinkedList&& other) { splice(end_cursor(), other); }
+
+	/**
+         * @brief Adds the elements of a range at the end of the list.
+         *
+         * The new nodes are linked to each other off the list and hooked
+         * onto its end in one step, so a range of this list itself, e.g.
+         * [begin(), end()), is copied once. If copying an element throws,
+         * the nodes made so far are freed and the list is left unchanged.
+         *
+         * @param first Input iterator to the first element to add.
+         * @param last Input iterator past the last element to add.
+         */
+	template <typename InputIt>
+	void append(InputIt first, InputIt last)
+	{
+		Link chain;
+		Link* tail = &chain;
+		size_t n = 0;
+		try {
+			for (; first != last; ++first) {
+				Node* x = new_node(*first);
+				tail->next = x;
+				x->prev = tail;
+				tail = x;
+				n++;
+			}
+		} catch (...) {
+			for (; n > 0; n--) {
+				Link* prev = tail->prev;
+				pool->destroy(static_cast<Node*>(tail));
+				tail = prev;
+			}
+			throw;
+		}
+		if (n == 0) {
+			return;
+		}
+		chain.next->prev = root.prev;
+		root.prev->next = chain.next;
+		tail->next = &root;
+		root.prev = tail;
+		size += n;
+	}
+
+	/**
+         * @brief Moves every element of another list in front of a cursor.
+         *
+         * The nodes are relinked without being copied, which needs both
+         * lists to allocate from the same pool. If they do not, one pool is
+         * merged into the other when only one list uses it, after which both
+         * lists share it. Only if both pools are shared with further lists
+         * are the elements copied over instead, in O(n).
+         *
+         * @param pos Cursor into this list, staying at its element.
+         * @param other The list to take the elements from, left empty.
+         */
+	void splice(Cursor pos, DoublyLinkedList& other)
+	{
+		if (&other == this || other.is_empty()) {
+			return;
+		}
+		splice(pos, other, other.cursor(), other.end_cursor(),
+		       other.size);
+	}
+
+	/**
+         * @brief Moves the elements in [@p first, @p last) of another list,
+         *        or of this one, in front of a cursor.
+         *
+         * Counting the moved elements takes O(k) time, use the overload
+         * taking the count to make this O(1).
+         *
+         * @param pos Cursor into this list, not inside the moved range.
+         * @param other The list to take the elements from.
+         * @param first Cursor at the first element to move.
+         * @param last Cursor after the last element to move.
+         */
+	void splice(Cursor pos, DoublyLinkedList& other, Cursor first,
+		    Cursor last)
+	{
+		size_t n = 0;
+		for (Link* p = first.cur; p != last.cur; p = p->next) {
+			n++;
+		}
+		splice(pos, other, first, last, n);
+	}
+
+	/**
+         * @brief Moves the @p n elements in [@p first, @p last) of another
+         *        list, or of this one, in front of a cursor in O(1).
+         *
+         * When @p other is another list, cursors at moved elements are
+         * invalidated, as they still walk @p other, or their element was
+         * erased from it when the pools forced a copy. Cursors at any other
+         * element, @p pos and @p last among them, stay valid.
+         *
+         * @param pos Cursor into this list, not inside the moved range.
+         * @param other The list to take the elements from.
+         * @param first Cursor at the first element to move.
+         * @param last Cursor after the last element to move.
+         * @param n The number of elements in the range.
+         */
+	void splice(Cursor pos, DoublyLinkedList& other, Cursor first,
+		    Cursor last, size_t n)
+	{
+		if (n == 0 || pos.cur == first.cur || pos.cur == last.cur) {
+			return;
+		}
+		if (!share_pool(other)) {
+			for (size_t i = 0; i < n; i++) {
+				pos.insert_before(first.get());
+				first.erase();
+			}
+			return;
+		}
+		Link* a = first.cur;
+		Link* b = last.cur->prev;
+		a->prev->next = last.cur;
+		last.cur->prev = a->prev;
+		other.size -= n;
+		Link* p = pos.cur;
+		a->prev = p->prev;
+		p->prev->next = a;
+		b->next = p;
+		p->prev = b;
+		size += n;
+	}
+
+	/**
+         * @brief Splits the list in two at a cursor.
+         *
+         * The elements from @p pos to the end are relinked into a new list
+         * sharing this list's pool. Counting them takes O(k) time.
+         *
+         * @param pos Cursor into this list.
+         * @return A list holding the elements from @p pos on.
+         */
+	DoublyLinkedList split_at(Cursor pos)
+	{
+		DoublyLinkedList rest;
+		rest.pool = pool;
+		size_t n = 0;
+		for (Link* p = pos.cur; p != &root; p = p->next) {
+			n++;
+		}
+		rest.splice(rest.end_cursor(), *this, pos, end_cursor(), n);
+		return rest;
+	}
+
+	/* Sorting functions */
+	/**
+         * @brief Sorts the list, keeping equal elements in their order.
+         *
+         * A bottom-up merge sort that only relinks the nodes, so no element
+         * is copied and nothing is allocated. Runs of 1, 2, 4, ... sorted
+         * nodes are kept in a fixed array of bins, merged through their next
+         * links only, and the prev links are restored in one final pass.
+         * Takes O(n log n) time.
+         *
+         * @param comp Strict weak ordering of the elements.
+         */
+	template <typename Compare = std::less<T>>
+	void sort(Compare comp = Compare())
+	{
+		if (size < 2) {
+			return;
+		}
+		Link* bins[64] = {};
+		size_t used = 0;
+		root.prev->next = nullptr;
+		Link* p = root.next;
+		while (p != nullptr) {
+			Link* carry = p;
+			p = p->next;
+			carry->next = nullptr;
+			size_t i = 0;
+			for (; bins[i] != nullptr; i++) {
+				carry = merge_chains(bins[i], carry, comp);
+				bins[i] = nullptr;
+			}
+			bins[i] = carry;
+			if (i == used) {
+				used++;
+			}
+		}
+		Link* sorted = nullptr;
+		for (size_t i = 0; i < used; i++) {
+			if (bins[i] != nullptr) {
+				sorted = merge_chains(bins[i], sorted, comp);
+			}
+		}
+		relink(sorted);
+	}
+
+	/**
+         * @brief Merges another sorted list into this sorted one.
+         *
+         * The nodes are relinked in O(n + m) time, elements of this list
+         * coming before equal ones of @p other. The lists need to share a
+         * pool as for @ref splice(), otherwise the elements of @p other are
+         * copied first.
+         *
+         * @param other A list sorted by @p comp, left empty.
+         * @param comp Strict weak ordering both lists are sorted by.
+         */
+	template <typename Compare = std::less<T>>
+	void merge(DoublyLinkedList& other, Compare comp = Compare())
+	{
+		if (&other == this || other.is_empty()) {
+			return;
+		}
+		if (!share_pool(other)) {
+			DoublyLinkedList copy(pool);
+			copy.splice(copy.end_cursor(), other);
+			merge(copy, comp);
+			return;
+		}
+		root.prev->next = nullptr;
+		other.root.prev->next = nullptr;
+		Link* a = size != 0 ? root.next : nullptr;
+		relink(merge_chains(a, other.root.next, comp));
+		size += other.size;
+		other.root.next = &other.root;
+		other.root.prev = &other.root;
+		other.size = 0;
+	}
+
+	/**
+         * @brief Merges several sorted lists into this sorted one.
+         *
+         * The lists are merged pairwise in rounds, so every element takes
+         * part in O(log k) merges for k lists. Equal elements keep the order
+         * of their lists, this one first.
+         *
+         * @param others Lists sorted by @p comp, left empty.
+         * @param comp Strict weak ordering all lists are sorted by.
+         */
+	template <typename Compare = std::less<T>>
+	void merge(const std::vector<DoublyLinkedList*>& others,
+		   Compare comp = Compare())
+	{
+		size_t k = others.size();
+		for (size_t step = 1; step < k; step *= 2) {
+			for (size_t i = 0; i + step < k; i += 2 * step) {
+				others[i]->merge(*others[i + step], comp);
+			}
+		}
+		if (k > 0) {
+			merge(*others[0], comp);
+		}
+	}
+
+	/* Iterators */
+	/** @brief Iterator to the first element. */
+	iterator begin() { return iterator(root.next); }
+
+	/** @brief Iterator past the last element. */
+	iterator end() { return iterator(&root); }
+
+	/** @brief Const iterator to the first element. */
+	const_iterator begin() const { return const_iterator(root.next); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator end() const
+	{
+		return const_iterator(const_cast<Link*>(&root));
+	}
+
+	/** @brief Const iterator to the first element. */
+	const_iterator cbegin() const { return begin(); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator cend() const { return end(); }
+
+	/**
+         * @brief Get a cursor at the first element, for editing the list
+         *        while walking it.
+         * @return A cursor at the first element, or at the end if the list
+         *         is empty.
+         */
+	Cursor cursor() { return Cursor(this, root.next); }
+
+	/**
+         * @brief Get a cursor past the last element, where
+         *        @ref Cursor::insert_before() appends.
+         * @return A cursor at the end.
+         */
+	Cursor end_cursor() { return Cursor(this, &root); }
+
 	/* Utility functions */
+	/**
+         * @brief Exchanges the elements and pools of two lists in O(1).
+         * @param other The list to swap with.
+         */
+	void swap(DoublyLinkedList& other) noexcept
+	{
+		std::swap(root, other.root);
+		std::swap(size, other.size);
+		pool.swap(other.pool);
+		reroot();
+		other.reroot();
+	}
+
+	/**
+         * @brief Deletes every node in the list.
+         *
+         * If no other list shares the node pool, its slabs are freed as a
+         * whole instead of giving back the nodes one at a time, and for
+         * trivially destructible elements the nodes are not even visited.
+         */
+	void clear()
+	{
+		release_nodes();
+		root.prev = root.next = &root;
+		size = 0;
+	}
+
+	/**
+         * @brief Moves every element into new nodes laid out one after
+         *        another in list order, in a single slab of a new pool.
+         *
+         * After long churn the nodes of a list end up scattered over many
+         * slabs and a traversal jumps around in memory. Compacting makes a
+         * traversal walk memory sequentially again. The old pool is freed
+         * as a whole if no other list shares it, otherwise it stays with
+         * those lists and this list no longer shares it. Elements are moved
+         * if their move constructor cannot throw and copied otherwise, so
+         * the list is left unchanged if copying throws.
+         *
+         * Iterators and cursors into the list are invalidated.
+         */
+	void compact()
+	{
+		if (size == 0) {
+			release_nodes();
+			pool.reset();
+			return;
+		}
+		std::shared_ptr<Pool> fresh = std::make_shared<Pool>();
+		fresh->reserve(size);
+		Link chain;
+		Link* last = &chain;
+		try {
+			for (Link* p = root.next; p != &root; p = p->next) {
+				Node* x = fresh->create(
+					std::move_if_noexcept(value(p)));
+				last->next = x;
+				x->prev = last;
+				last = x;
+			}
+		} catch (...) {
+			for (Link* p = chain.next; p != nullptr;) {
+				Link* next = p->next;
+				fresh->destroy(static_cast<Node*>(p));
+				p = next;
+			}
+			throw;
+		}
+		release_nodes();
+		pool = fresh;
+		root.next = chain.next;
+		root.next->prev = &root;
+		root.prev = last;
+		last->next = &root;
+	}
+
+	/**
+         * @brief Copies the elements into a flat array in list order.
+         *
+         * Meant for scan heavy phases in which the list is only read: the
+         * array is traversed without following any links, and stays valid
+         * however the list changes afterwards.
+         *
+         * @return The elements in list order.
+         */
+	std::vector<T> freeze() const
+	{
+		std::vector<T> flat;
+		flat.reserve(size);
+		for (const T& x : *this) {
+			flat.push_back(x);
+		}
+		return flat;
+	}
+
+	/**
+         * @brief Get the pool the nodes are allocated from, creating it if
+         *        the list has none yet.
+         *
+         * The pool can be passed to the constructor of another list, which
+         * then reuses the nodes freed by this one and vice versa.
+         *
+         * @return The node pool.
+         */
+	std::shared_ptr<Pool> get_pool()
+	{
+		if (!pool) {
+			pool = std::make_shared<Pool>();
+		}
+		return pool;
+	}
+
 	/** 
          * @brief Get the current size of the doubly linked list.
          * @return Current size of the doubly linked list.
@@ -283,9 +828,9 @@ public:
 	void display() const
 	{
 		std::cout << "Size = " << size << '\n';
-		Node* p = head->next;
-		while (p != tail) {
-			std::cout << p->data << " <-> ";
+		Link* p = root.next;
+		while (p != &root) {
+			std::cout << value(p) << " <-> ";
 			p = p->next;
 		}
 		std::cout << "nullptr" << '\n';
@@ -293,14 +838,20 @@ public:
 	}
 
 private:
+	/** @brief Links shared by the element nodes and the sentinel. */
+	struct Link {
+		/** Pointer to the previous node. */
+		Link* prev;
+		/** Pointer to the next node. */
+		Link* next;
+
+		Link() : prev(nullptr), next(nullptr) {}
+	};
+
 	/** @brief Struct representing a node in a doubly linked list. */
-	struct Node {
+	struct Node : Link {
 		/** The data stored in the node. */
 		T data;
-		/** Pointer to the previous node. */
-		Node* prev;
-		/** Pointer to the next node. */
-		Node* next;
 
 		/**
                  * @brief Constructs a new node with the given data and
@@ -308,14 +859,162 @@ private:
                  *
                  * @param val The value of the data to store in the node.
                  */
-		Node(T val) : data(val), prev(nullptr), next(nullptr) {}
+		Node(T val) : data(std::move(val)) {}
 	};
-	/** Dummy head node. */
-	Node* head;
-	/** Dummy tail node. */
-	Node* tail;
+	/**
+         * Sentinel before the first and after the last element, linked to
+         * itself while the list is empty.
+         */
+	Link root;
 	/** Current size of the doubly linked list. */
 	size_t size;
+	/** Pool of the element nodes, created along with the first one. */
+	std::shared_ptr<Pool> pool;
+
+	/**
+         * @brief Allocates a node from the pool.
+         * @param data The data to store in the node.
+         * @return Pointer to the new node.
+         */
+	Node* new_node(const T& data) { return get_pool()->create(data); }
+
+	/** @brief Get the element stored in an element node. */
+	static T& value(Link* p) { return static_cast<Node*>(p)->data; }
+
+	/**
+         * @brief Points the neighbours of the sentinel back at it after its
+         *        links were copied from another list.
+         */
+	void reroot()
+	{
+		if (size == 0) {
+			root.prev = root.next = &root;
+		} else {
+			root.next->prev = &root;
+			root.prev->next = &root;
+		}
+	}
+
+	/**
+         * @brief Merges two null terminated sorted chains of nodes through
+         *        their next links, taking from @p a first on ties.
+         * @return The first node of the merged chain.
+         */
+	template <typename Compare>
+	static Link* merge_chains(Link* a, Link* b, Compare& comp)
+	{
+		Link* first = nullptr;
+		Link** link = &first;
+		while (a != nullptr && b != nullptr) {
+			if (comp(value(b), value(a))) {
+				*link = b;
+				link = &b->next;
+				b = b->next;
+			} else {
+				*link = a;
+				link = &a->next;
+				a = a->next;
+			}
+		}
+		*link = a != nullptr ? a : b;
+		return first;
+	}
+
+	/**
+         * @brief Links a null terminated chain in as the only elements,
+         *        restoring the prev links along the way.
+         */
+	void relink(Link* first)
+	{
+		Link* prev = &root;
+		for (Link* p = first; p != nullptr; p = p->next) {
+			p->prev = prev;
+			prev->next = p;
+			prev = p;
+		}
+		prev->next = &root;
+		root.prev = prev;
+	}
+
+	/**
+         * @brief Makes this list and @p other allocate from the same pool,
+         *        merging one pool into the other if only one list uses it.
+         * @return false if both pools are also used by further lists.
+         */
+	bool share_pool(DoublyLinkedList& other)
+	{
+		if (pool == other.pool) {
+			return true;
+		}
+		if (!pool) {
+			pool = other.pool;
+			return true;
+		}
+		if (!other.pool) {
+			other.pool = pool;
+			return true;
+		}
+		if (other.pool.use_count() == 1) {
+			pool->merge(*other.pool);
+			other.pool = pool;
+			return true;
+		}
+		if (pool.use_count() == 1) {
+			other.pool->merge(*pool);
+			pool = other.pool;
+			return true;
+		}
+		return false;
+	}
+
+	/** @brief Links a new node holding @p data before node @p p. */
+	Link* link_before(Link* p, const T& data)
+	{
+		Node* x = new_node(data);
+		Link* prev = p->prev;
+		prev->next = x;
+		x->prev = prev;
+		x->next = p;
+		p->prev = x;
+		size++;
+		return x;
+	}
+
+	/** @brief Unlinks and frees an element node. */
+	void unlink(Link* x)
+	{
+		x->prev->next = x->next;
+		x->next->prev = x->prev;
+		pool->destroy(static_cast<Node*>(x));
+		size--;
+	}
+
+	/**
+         * @brief Frees every element node, leaving the links of the
+         *        sentinel untouched.
+         */
+	void release_nodes()
+	{
+		if (!pool) {
+			return;
+		}
+		bool sole = pool.use_count() == 1;
+		if (!sole || !std::is_trivially_destructible<T>::value) {
+			Link* p = root.next;
+			while (p != &root) {
+				Link* next = p->next;
+				if (sole) {
+					static_cast<Node*>(p)->~Node();
+				} else {
+					pool->destroy(static_cast<Node*>(p));
+				}
+				p = next;
+			}
+		}
+		if (sole) {
+			pool->release();
+		}
+	}
 
 	/** 
          * @brief Get the requested node.
@@ -326,17 +1025,17 @@ private:
          * @param index Index of the desired node.
          * @return Pointer to the requested node.
          */
-	Node* get_node(int index)
+	Link* get_node(int index)
 	{
 		check_element_index(index);
-		Node* p = head->next;
+		Link* p = root.next;
 		if (index < int(size) / 2) {
-			p = head->next;
+			p = root.next;
 			for (int i = 0; i < index; i++) {
 				p = p->next;
 			}
 		} else {
-			p = tail->prev;
+			p = root.prev;
 			for (int i = int(size) - 1; i > index; i--) {
 				p = p->prev;
 			}
@@ -401,6 +1100,182 @@ private:
 	}
 };
 
+/**
+ * @class DoublyLinkedList::Cursor
+ * @brief Position in a DoublyLinkedList at which elements can be inserted
+ *        and erased in O(1).
+ *
+ * The cursor stays valid across its own edits and across edits elsewhere
+ * in the list, as long as its current element is not deleted or moved to
+ * another list by them.
+ */
+template <typename T>
+class DoublyLinkedList<T>::Cursor {
+public:
+	/**
+         * @brief Check if the cursor is past the last element.
+         * @return true if there is no current element.
+         */
+	bool is_end() const { return cur == &list->root; }
+
+	/**
+         * @brief Get the current element.
+         * @return Reference to the current element.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	T& get() const
+	{
+		check_not_end();
+		return value(cur);
+	}
+
+	/**
+         * @brief Moves the cursor to the next element.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	void advance()
+	{
+		check_not_end();
+		cur = cur->next;
+	}
+
+	/**
+         * @brief Moves the cursor to the previous element.
+         * @throws std::out_of_range if the cursor is at the first element.
+         */
+	void retreat()
+	{
+		if (cur->prev == &list->root) {
+			throw std::out_of_range(
+				"Cursor is at the first element");
+		}
+		cur = cur->prev;
+	}
+
+	/**
+         * @brief Inserts an element before the current one, the cursor
+         *        staying on the current element. At the end, this appends.
+         * @param data The element to be inserted.
+         */
+	void insert_before(const T& data) { list->link_before(cur, data); }
+
+	/**
+         * @brief Inserts an element after the current one, the cursor
+         *        staying on the current element.
+         * @param data The element to be inserted.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	void insert_after(const T& data)
+	{
+		check_not_end();
+		list->link_before(cur->next, data);
+	}
+
+	/**
+         * @brief Deletes the current element, moving the cursor to the
+         *        next one.
+         * @return The deleted element.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	T erase()
+	{
+		check_not_end();
+		Link* x = cur;
+		cur = cur->next;
+		T data = value(x);
+		list->unlink(x);
+		return data;
+	}
+
+private:
+	friend class DoublyLinkedList;
+
+	/** The list the cursor walks. */
+	DoublyLinkedList* list;
+	/** Node of the current element, the sentinel at the end. */
+	Link* cur;
+
+	Cursor(DoublyLinkedList* l, Link* p) : list(l), cur(p) {}
+
+	void check_not_end() const
+	{
+		if (is_end()) {
+			throw std::out_of_range(
+				"Cursor is past the last element");
+		}
+	}
+};
+
+/**
+ * @brief Bidirectional iterator over a DoublyLinkedList.
+ */
+template <typename T>
+template <bool IsConst>
+class DoublyLinkedList<T>::Iterator {
+public:
+	typedef std::bidirectional_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+	typedef typename std::conditional<IsConst, const T&, T&>::type
+		reference;
+
+	Iterator() : cur(nullptr) {}
+
+	explicit Iterator(Link* n) : cur(n) {}
+
+	// Allows an iterator to be passed where a const_iterator is expected.
+	template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+	Iterator(const Iterator<false>& other) : cur(other.cur)
+	{
+	}
+
+	reference operator*() const { return value(cur); }
+
+	pointer operator->() const { return &value(cur); }
+
+	Iterator& operator++()
+	{
+		cur = cur->next;
+		return *this;
+	}
+
+	Iterator operator++(int)
+	{
+		Iterator old = *this;
+		cur = cur->next;
+		return old;
+	}
+
+	Iterator& operator--()
+	{
+		cur = cur->prev;
+		return *this;
+	}
+
+	Iterator operator--(int)
+	{
+		Iterator old = *this;
+		cur = cur->prev;
+		return old;
+	}
+
+	bool operator==(const Iterator& other) const
+	{
+		return cur == other.cur;
+	}
+
+	bool operator!=(const Iterator& other) const
+	{
+		return cur != other.cur;
+	}
+
+private:
+	friend class Iterator<!IsConst>;
+
+	Link* cur;
+};
+
 } // namespace DataStructures
 
 #endif // DATA_STRUCTURES_DOUBLY_LINKED_LIST_H
@@ -1,8 +1,11 @@
 #ifndef DATA_STRUCTURES_DYNAMIC_ARRAY_H
 #define DATA_STRUCTURES_DYNAMIC_ARRAY_H
 
+#include <climits>
 #include <iostream>
+#include <iterator>
 #include <stdexcept>
+#include <utility>
 
 namespace DataStructures {
 
@@ -17,16 +20,11 @@ public:
 	/**
          * @brief Default constructor for the DynamicArray class.
          *
-         * Initializes an array of type T and size default initial capacity. The
-         * current size is set to zero and the capacity is initializd to the 
-         * default initial capacity.
+         * No memory is allocated until the first element is added, when an
+         * array of the default initial capacity is created. The current size
+         * and the capacity are set to zero.
          */
-	DynamicArray()
-	{
-		data = new T[init_cap];
-		size = 0;
-		cap = init_cap;
-	}
+	DynamicArray() noexcept {}
 
 	/**
          * @brief Constructor for DynamicArray class with specified initial
@@ -45,6 +43,46 @@ public:
 		cap = initial_capacity;
 	}
 
+	/**
+         * @brief Copy constructor, copying every element into an array of
+         *        the same capacity.
+         * @param other The array to copy.
+         */
+	DynamicArray(const DynamicArray& other)
+	{
+		if (other.cap > 0) {
+			data = new T[other.cap];
+			for (size_t i = 0; i < other.size; i++) {
+				data[i] = other.data[i];
+			}
+		}
+		size = other.size;
+		cap = other.cap;
+	}
+
+	/**
+         * @brief Move constructor, taking over the storage of another array
+         *        in O(1).
+         * @param other The array to move from, left empty without storage.
+         */
+	DynamicArray(DynamicArray&& other) noexcept { swap(other); }
+
+	/**
+         * @brief Assignment, replacing the elements by those of another
+         *        array.
+         *
+         * Takes @p other by value, so it is copied or moved as appropriate
+         * and the old storage is freed along with it.
+         *
+         * @param other The array to take the elements from.
+         * @return Reference to this array.
+         */
+	DynamicArray& operator=(DynamicArray other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
 	/**
          * @brief Default destructor for the DynamicArray class.
          *
@@ -52,6 +90,17 @@ public:
          */
 	~DynamicArray() { delete[] data; }
 
+	/**
+         * @brief Exchanges the storage of two arrays in O(1).
+         * @param other The array to swap with.
+         */
+	void swap(DynamicArray& other) noexcept
+	{
+		std::swap(data, other.data);
+		std::swap(size, other.size);
+		std::swap(cap, other.cap);
+	}
+
 	/** Add functions */
 	/**
          * @brief Adds an element at the end of the array.
@@ -65,12 +114,32 @@ public:
 	void add_last(const T& element)
 	{
 		if (int(size) == cap) {
-			resize(2 * cap);
+			grow();
 		}
 		data[size] = element;
 		size++;
 	}
 
+	/**
+         * @brief Adds the elements of a range at the end of the array.
+         *
+         * The capacity is raised once to fit the whole range, and the
+         * elements are then copied one after the other into it.
+         *
+         * @param first Forward iterator to the first element to add.
+         * @param last Forward iterator past the last element to add.
+         */
+	template <typename ForwardIt>
+	void append(ForwardIt first, ForwardIt last)
+	{
+		size_t n = size_t(std::distance(first, last));
+		reserve(size + n);
+		for (; first != last; ++first) {
+			data[size] = *first;
+			size++;
+		}
+	}
+
 	/**
          * @brief Adds an element at a specified index.
          *
@@ -88,7 +157,7 @@ public:
 	{
 		check_position_index(pos_index);
 		if (int(size) == cap) {
-			resize(2 * cap);
+			grow();
 		}
 		for (int i = int(size) - 1; i >= pos_index; i--) {
 			data[i + 1] = data[i];
@@ -132,6 +201,62 @@ public:
 		return last_element;
 	}
 
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the array was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the array was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_last();
+		return true;
+	}
+
+	/**
+         * @brief Deletes the last @p count elements at once.
+         *
+         * The capacity is halved as often as @ref del_last() would have
+         * halved it, but with a single reallocation.
+         *
+         * @param count The number of elements to delete.
+         * @throws std::out_of_range if the array has fewer elements.
+         */
+	void del_last_n(size_t count)
+	{
+		if (count > size) {
+			throw std::out_of_range(
+				"The array has fewer elements than requested");
+		}
+		for (size_t i = size - count; i < size; i++) {
+			data[i] = T();
+		}
+		size -= count;
+		// del_last() tests the size before it deletes, so the last of
+		// the deletions would see one more element than remain.
+		int new_cap = cap;
+		while (new_cap > 1 && int(size) + 1 <= new_cap / 4) {
+			new_cap /= 2;
+		}
+		if (new_cap != cap) {
+			resize(new_cap);
+		}
+	}
+
 	/**
          * @brief Deletes the element at a particular index.
          *
@@ -185,6 +310,25 @@ public:
 		return data[index];
 	}
 
+	/**
+         * @brief Unchecked access to the element at a specified index.
+         *
+         * Unlike @ref get() no bounds check is done and a reference is
+         * returned, so elements can be moved in and out in place.
+         *
+         * @param index Index of the element, must be in [0, size).
+         * @return Reference to the element at the specified index.
+         */
+	T& operator[](size_t index) { return data[index]; }
+
+	/**
+         * @brief Unchecked read-only access to the element at a specified
+         *        index.
+         * @param index Index of the element, must be in [0, size).
+         * @return Reference to the element at the specified index.
+         */
+	const T& operator[](size_t index) const { return data[index]; }
+
 	/* Set functions */
 	/**
          * @brief Sets the value of an element at a particular index.
@@ -212,25 +356,57 @@ public:
          */
 	size_t get_size() const { return size; }
 
+	/**
+         * @brief Get the number of elements the array holds storage for.
+         * @return Capacity of the array.
+         */
+	size_t get_capacity() const { return size_t(cap); }
+
+	/**
+         * @brief Raises the capacity to at least @p n elements.
+         *
+         * Does nothing if the capacity is already large enough, so that a
+         * following run of @p n additions reallocates at most once.
+         *
+         * @param n The number of elements to make room for.
+         * @throws std::length_error if @p n does not fit the capacity type.
+         */
+	void reserve(size_t n)
+	{
+		if (n > size_t(INT_MAX)) {
+			throw std::length_error("DynamicArray is too large");
+		}
+		if (int(n) > cap) {
+			resize(int(n));
+		}
+	}
+
 	/**
          * @brief Check if the array is empty.
          * @return true if the array is empty, false otherwise.
          */
 	bool is_empty() const { return size == 0; }
 
+	/**
+         * @brief Doubles the capacity of a full array, or allocates the
+         *        default initial capacity if it has no storage yet.
+         */
+	void grow() { resize(cap == 0 ? init_cap : 2 * cap); }
+
 	/**
          * @brief Resize the array to a new capacity.
          *
-         * Creates an array with the new capacity, copies the old data to it and
-         * makes the old array pointer point to this new array. The capacity is
-         * updated accordingly.
+         * Creates an array with the new capacity, moves the old data to it,
+         * frees the old array and makes the old array pointer point to this new
+         * array. The capacity is updated accordingly.
          */
 	void resize(int new_cap)
 	{
 		T* temp = new T[new_cap];
 		for (int i = 0; i < int(size); i++) {
-			temp[i] = data[i];
+			temp[i] = std::move(data[i]);
 		}
+		delete[] data;
 		data = temp;
 		cap = new_cap;
 	}
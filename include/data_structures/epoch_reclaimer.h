@@ -0,0 +1,355 @@
+#ifndef DATA_STRUCTURES_EPOCH_RECLAIMER_H
+#define DATA_STRUCTURES_EPOCH_RECLAIMER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+ * @class EpochReclaimer
+ * @brief Epoch-based memory reclamation for lock-free containers.
+ *
+ * A global epoch counter advances once every thread inside a critical
+ * section has observed its current value. A thread entering a critical
+ * section publishes the epoch it saw; a node retired during epoch @c e can
+ * no longer be referenced by anybody once the global epoch reaches
+ * @c e + 2, since every thread that could have read it has left the
+ * section it read it in. Nodes are therefore freed in batches without any
+ * per-access publication, which makes reads cheaper than with
+ * @ref HazardPointers at the cost of unbounded garbage while a thread
+ * stalls inside a critical section.
+ *
+ * This class provides the same interface as @ref HazardPointers and can be
+ * used as the @c Reclaimer of any lock-free container. Guards nest freely
+ * and @c protect() is a plain acquire load, as the guard alone keeps every
+ * node reachable at its construction alive, so there is no limit on the
+ * number of nodes protected at once.
+ *
+ * A thread registers itself on its first guard or retire by taking a free
+ * record, and releases the record when it exits. Nodes it still holds then
+ * are handed to the next thread that collects.
+ */
+class EpochReclaimer {
+	struct Record;
+	struct ThreadState;
+
+public:
+	/**
+         * @class Guard
+         * @brief Critical section in which the calling thread may access
+         *        shared nodes.
+         */
+	class Guard {
+	public:
+		/** @brief Enters a critical section unless inside one. */
+		Guard() : state(local())
+		{
+			if (state.depth++ == 0) {
+				enter(state.record());
+			}
+		}
+
+		/** @brief Leaves the critical section if outermost. */
+		~Guard()
+		{
+			if (--state.depth == 0) {
+				state.rec->epoch.store(
+					0, std::memory_order_release);
+			}
+		}
+
+		Guard(const Guard&) = delete;
+		Guard& operator=(const Guard&) = delete;
+
+		/**
+                 * @brief Reads a shared pointer inside the critical section.
+                 * @param src The shared pointer to read.
+                 * @return The value of @p src, valid until the guard is left.
+                 */
+		template <typename P>
+		P* protect(const std::atomic<P*>& src, size_t = 0)
+		{
+			return src.load(std::memory_order_acquire);
+		}
+
+		/** @brief Has no effect, kept for interface compatibility. */
+		void clear(size_t) {}
+
+	private:
+		ThreadState& state;
+	};
+
+	/**
+         * @brief Hands over an unlinked node to be freed once no critical
+         *        section that could have read it is left.
+         * @param p The unlinked node.
+         * @param deleter Function freeing the node.
+         */
+	static void retire(void* p, void (*deleter)(void*))
+	{
+		ThreadState& state = local();
+		state.record();
+		uint64_t e = domain().epoch.load(std::memory_order_seq_cst);
+		state.retired.push_back(Retired(p, deleter, e));
+		if (++state.since_collect >= batch) {
+			collect(state);
+		}
+	}
+
+	/**
+         * @brief Hands over an unlinked node to be deleted once no critical
+         *        section that could have read it is left.
+         * @param p The unlinked node, allocated with @c new.
+         */
+	template <typename P>
+	static void retire(P* p)
+	{
+		retire(p, &delete_as<P>);
+	}
+
+	/**
+         * @brief Tries to advance the epoch and frees every node of the
+         *        calling thread, and of exited threads, that has become safe.
+         *
+         * Called outside of a critical section, two calls in a row free every
+         * node retired before them unless another thread is inside one.
+         */
+	static void collect() { collect(local()); }
+
+	/**
+         * @brief Gets the number of nodes retired by the calling thread that
+         *        have not been freed yet.
+         * @return The number of pending nodes.
+         */
+	static size_t pending() { return local().retired.size(); }
+
+private:
+	/** Retires between two attempts to advance the epoch and free. */
+	static const size_t batch = 64;
+
+	/** @brief Published state of one thread, never freed once created. */
+	struct Record {
+		/** Observed epoch times two plus one, zero when outside. */
+		std::atomic<uint64_t> epoch;
+		std::atomic<bool> active;
+		Record* next;
+
+		Record() : epoch(0), active(true), next(nullptr) {}
+	};
+
+	/** @brief A retired node, its deleter and its retire epoch. */
+	struct Retired {
+		void* ptr;
+		void (*deleter)(void*);
+		uint64_t epoch;
+
+		Retired(void* p, void (*d)(void*), uint64_t e)
+			: ptr(p), deleter(d), epoch(e)
+		{
+		}
+	};
+
+	/** @brief Global epoch, list of records and orphaned nodes. */
+	struct Domain {
+		std::atomic<uint64_t> epoch;
+		std::atomic<Record*> head;
+		std::mutex orphans_mtx;
+		std::vector<Retired> orphans;
+
+		Domain() : epoch(1), head(nullptr) {}
+
+		~Domain()
+		{
+			for (Retired& r : orphans) {
+				r.deleter(r.ptr);
+			}
+			Record* p = head.load();
+			while (p != nullptr) {
+				Record* next = p->next;
+				delete p;
+				p = next;
+			}
+		}
+
+		/** @brief Reuses an inactive record or links a new one. */
+		Record* acquire()
+		{
+			for (Record* p = head.load(std::memory_order_acquire);
+			     p != nullptr; p = p->next) {
+				bool idle = false;
+				if (p->active.compare_exchange_strong(idle,
+								      true)) {
+					return p;
+				}
+			}
+			Record* rec = new Record();
+			Record* old = head.load(std::memory_order_relaxed);
+			do {
+				rec->next = old;
+			} while (!head.compare_exchange_weak(
+				old, rec, std::memory_order_release,
+				std::memory_order_relaxed));
+			return rec;
+		}
+
+		/**
+                 * @brief Advances the epoch if every thread inside a critical
+                 *        section has observed the current one.
+                 * @return The global epoch after the attempt.
+                 */
+		uint64_t try_advance()
+		{
+			uint64_t e = epoch.load(std::memory_order_seq_cst);
+			for (Record* p = head.load(std::memory_order_acquire);
+			     p != nullptr; p = p->next) {
+				uint64_t seen = p->epoch.load(
+					std::memory_order_seq_cst);
+				if ((seen & 1) != 0 && (seen >> 1) != e) {
+					return e;
+				}
+			}
+			if (epoch.compare_exchange_strong(e, e + 1)) {
+				return e + 1;
+			}
+			return e;
+		}
+	};
+
+	/** @brief Record, nesting depth and retired list of a thread. */
+	struct ThreadState {
+		Record* rec;
+		size_t depth;
+		size_t since_collect;
+		/** Global epoch at the last scan of the retired list. */
+		uint64_t scanned;
+		std::vector<Retired> retired;
+
+		ThreadState()
+			: rec(nullptr), depth(0), since_collect(0), scanned(0)
+		{
+		}
+
+		/**
+                 * @brief Frees what can be freed and passes the rest on to
+                 *        the domain before giving up the record.
+                 */
+		~ThreadState()
+		{
+			if (!retired.empty()) {
+				collect(*this);
+			}
+			if (!retired.empty()) {
+				Domain& d = domain();
+				std::lock_guard<std::mutex> guard(
+					d.orphans_mtx);
+				d.orphans.insert(d.orphans.end(),
+						 retired.begin(),
+						 retired.end());
+			}
+			if (rec != nullptr) {
+				rec->active.store(false,
+						  std::memory_order_release);
+			}
+		}
+
+		Record* record()
+		{
+			if (rec == nullptr) {
+				rec = domain().acquire();
+			}
+			return rec;
+		}
+	};
+
+	static Domain& domain()
+	{
+		static Domain d;
+		return d;
+	}
+
+	static ThreadState& local()
+	{
+		static thread_local ThreadState state;
+		return state;
+	}
+
+	template <typename P>
+	static void delete_as(void* p)
+	{
+		delete static_cast<P*>(p);
+	}
+
+	/**
+         * @brief Publishes the current epoch for the calling thread.
+         *
+         * The epoch is read again after the store is visible, so that an
+         * advance racing with the store cannot go unnoticed.
+         */
+	static void enter(Record* rec)
+	{
+		Domain& d = domain();
+		uint64_t e = d.epoch.load(std::memory_order_relaxed);
+		for (;;) {
+			rec->epoch.store((e << 1) | 1,
+					 std::memory_order_seq_cst);
+			uint64_t again =
+				d.epoch.load(std::memory_order_seq_cst);
+			if (again == e) {
+				return;
+			}
+			e = again;
+		}
+	}
+
+	/**
+         * @brief Advances the epoch if possible and frees the nodes of
+         *        @p state retired at least two epochs ago.
+         *
+         * Also adopts the nodes left behind by exited threads.
+         */
+	static void collect(ThreadState& state)
+	{
+		Domain& d = domain();
+		state.since_collect = 0;
+		bool adopted = false;
+		{
+			std::unique_lock<std::mutex> lock(d.orphans_mtx,
+							  std::try_to_lock);
+			if (lock.owns_lock() && !d.orphans.empty()) {
+				state.retired.insert(state.retired.end(),
+						     d.orphans.begin(),
+						     d.orphans.end());
+				d.orphans.clear();
+				adopted = true;
+			}
+		}
+		uint64_t e = d.try_advance();
+		// Nothing became safe while a stalled section holds the
+		// epoch back, so skip rescanning a possibly long list.
+		if (e == state.scanned && !adopted) {
+			return;
+		}
+		state.scanned = e;
+		// Deleters may retire further nodes, so free a detached list.
+		std::vector<Retired> todo;
+		todo.swap(state.retired);
+		for (Retired& r : todo) {
+			if (r.epoch + 2 > e) {
+				state.retired.push_back(r);
+			}
+		}
+		for (Retired& r : todo) {
+			if (r.epoch + 2 <= e) {
+				r.deleter(r.ptr);
+			}
+		}
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_EPOCH_RECLAIMER_H
@@ -0,0 +1,198 @@
+#ifndef DATA_STRUCTURES_HASH_INDEX_H
+#define DATA_STRUCTURES_HASH_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+ * @class HashIndex
+ * @brief Open addressing hash table mapping hashes to 32-bit entry
+ *        indices, for containers that keep their entries in an array.
+ *
+ * The index only stores the entry index and 32 bits of the hash of every
+ * key, eight bytes per slot, and leaves the keys to the container, which
+ * is asked to compare its key with an entry only when the stored hash
+ * bits match. Collisions are resolved by linear probing, and deletions
+ * shift the following slots back instead of leaving tombstones, so lookups
+ * never get slower as entries come and go. The table doubles whenever it
+ * would become more than half full.
+ */
+class HashIndex {
+public:
+	/** Entry index standing for no entry. */
+	static const uint32_t npos = UINT32_MAX;
+
+	/**
+         * @brief Constructor for an empty HashIndex.
+         *
+         * No memory is allocated until the first insertion.
+         */
+	HashIndex() : mask(0), count(0) {}
+
+	/**
+         * @brief Folds a full hash value into the 32 bits stored per slot.
+         *
+         * Multiplying by a large odd constant spreads the input bits over
+         * the upper half, so that hashes differing only in their high bits,
+         * or identity hashes of small integers, still spread over the table.
+         *
+         * @param h A hash value, e.g. from @c std::hash.
+         * @return The folded hash.
+         */
+	static uint32_t fold(size_t h)
+	{
+		uint64_t x = uint64_t(h) * 0x9E3779B97F4A7C15ULL;
+		return uint32_t(x >> 32);
+	}
+
+	/**
+         * @brief Finds the entry whose key has the given hash and matches.
+         * @param hash The folded hash of the key.
+         * @param match Called with candidate entry indices, returning true
+         *              for the one holding the key.
+         * @return The index of the matching entry, or @ref npos.
+         */
+	template <typename Match>
+	uint32_t find(uint32_t hash, Match match) const
+	{
+		if (count == 0) {
+			return npos;
+		}
+		for (size_t i = hash & mask;; i = (i + 1) & mask) {
+			const Slot& s = slots[i];
+			if (s.entry == npos) {
+				return npos;
+			}
+			if (s.hash == hash && match(s.entry)) {
+				return s.entry;
+			}
+		}
+	}
+
+	/**
+         * @brief Adds an entry whose key is not in the index yet.
+         * @param hash The folded hash of the key.
+         * @param entry The index of the entry.
+         */
+	void insert(uint32_t hash, uint32_t entry)
+	{
+		if (2 * (count + 1) > slots.size()) {
+			size_t n = 2 * slots.size();
+			rehash(n == 0 ? size_t(min_slots) : n);
+		}
+		place(hash, entry);
+		count++;
+	}
+
+	/**
+         * @brief Removes an entry.
+         * @param hash The folded hash of the key of the entry.
+         * @param entry The index of the entry, which must be in the index.
+         */
+	void erase(uint32_t hash, uint32_t entry)
+	{
+		size_t i = locate(hash, entry);
+		for (size_t j = (i + 1) & mask; slots[j].entry != npos;
+		     j = (j + 1) & mask) {
+			size_t home = slots[j].hash & mask;
+			// Slot j may fill the hole if the hole lies on its
+			// probe path, i.e. cyclically in [home, j).
+			if (((j - home) & mask) >= ((j - i) & mask)) {
+				slots[i] = slots[j];
+				i = j;
+			}
+		}
+		slots[i].entry = npos;
+		count--;
+	}
+
+	/**
+         * @brief Changes the entry index stored for a key, after its entry
+         *        was moved to another position in the container.
+         * @param hash The folded hash of the key.
+         * @param from The old index of the entry.
+         * @param to The new index of the entry.
+         */
+	void relocate(uint32_t hash, uint32_t from, uint32_t to)
+	{
+		slots[locate(hash, from)].entry = to;
+	}
+
+	/**
+         * @brief Removes every entry and frees the table.
+         */
+	void clear()
+	{
+		std::vector<Slot>().swap(slots);
+		mask = 0;
+		count = 0;
+	}
+
+	/**
+         * @brief Get the number of entries in the index.
+         * @return Number of entries.
+         */
+	size_t get_size() const { return count; }
+
+private:
+	/** Number of slots of the first table. */
+	static const size_t min_slots = 16;
+
+	/** @brief Slot of the table, empty if @ref entry is @ref npos. */
+	struct Slot {
+		/** Index of the entry. */
+		uint32_t entry;
+		/** Folded hash of the key of the entry. */
+		uint32_t hash;
+
+		Slot() : entry(npos), hash(0) {}
+	};
+
+	/** The table, its size a power of two. */
+	std::vector<Slot> slots;
+	/** Size of the table minus one. */
+	size_t mask;
+	/** Number of entries. */
+	size_t count;
+
+	/** @brief Get the slot holding @p entry, which must be present. */
+	size_t locate(uint32_t hash, uint32_t entry) const
+	{
+		size_t i = hash & mask;
+		while (slots[i].entry != entry) {
+			i = (i + 1) & mask;
+		}
+		return i;
+	}
+
+	/** @brief Puts an entry into the first free slot of its probe path. */
+	void place(uint32_t hash, uint32_t entry)
+	{
+		size_t i = hash & mask;
+		while (slots[i].entry != npos) {
+			i = (i + 1) & mask;
+		}
+		slots[i].entry = entry;
+		slots[i].hash = hash;
+	}
+
+	/** @brief Moves every entry into a table of @p n slots. */
+	void rehash(size_t n)
+	{
+		std::vector<Slot> old(n);
+		old.swap(slots);
+		mask = n - 1;
+		for (const Slot& s : old) {
+			if (s.entry != npos) {
+				place(s.hash, s.entry);
+			}
+		}
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_HASH_INDEX_H
@@ -0,0 +1,320 @@
+#ifndef DATA_STRUCTURES_HAZARD_POINTERS_H
+#define DATA_STRUCTURES_HAZARD_POINTERS_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+ * @class HazardPointers
+ * @brief Hazard pointer memory reclamation for lock-free containers.
+ *
+ * Before dereferencing a shared node a thread publishes its address in one
+ * of its hazard slots. A node that has been unlinked is retired instead of
+ * deleted, and is only freed once no slot of any thread holds its address.
+ * Besides making the memory safe to access, this rules out the ABA problem
+ * for the protected pointers: a node cannot be freed and reused at the same
+ * address while a thread that read it may still compare against it.
+ *
+ * This class is one of the reclamation policies accepted by the lock-free
+ * containers, which only rely on the following interface:
+ * - a nested @c Guard, constructed to enter a region where shared nodes
+ *   are accessed and destroyed to leave it, with
+ *   @c protect(src, slot) returning a safely dereferenceable snapshot of
+ *   @c src and @c clear(slot);
+ * - a static @c retire(p, deleter) and @c retire(p) handing over an
+ *   unlinked node.
+ *
+ * Every thread owns one record with @ref slots_per_thread slots, so a thread
+ * may hold only one guard at a time. Retired nodes are kept in a per-thread
+ * list which is scanned once it grows past a threshold proportional to the
+ * total number of slots. Nodes still retired when their thread exits are
+ * handed to the next thread that scans.
+ */
+class HazardPointers {
+	struct Record;
+
+public:
+	/** @brief Number of hazard slots available to each thread. */
+	static size_t slots_per_thread() { return max_slots; }
+
+	/**
+         * @class Guard
+         * @brief Scope in which the calling thread may protect nodes.
+         */
+	class Guard {
+	public:
+		Guard() : rec(local().record()) {}
+
+		/** @brief Clears every slot of the thread. */
+		~Guard()
+		{
+			for (size_t i = 0; i < max_slots; i++) {
+				clear(i);
+			}
+		}
+
+		Guard(const Guard&) = delete;
+		Guard& operator=(const Guard&) = delete;
+
+		/**
+                 * @brief Publishes a hazard for the current value of @p src.
+                 *
+                 * Loads @p src, stores it into the slot and loads again
+                 * until both loads agree. At that point the node was still
+                 * reachable after the hazard became visible, so any later
+                 * scan will see it and the node stays valid until the slot
+                 * is cleared or reused.
+                 *
+                 * @param src The shared pointer to read.
+                 * @param slot The slot to publish the hazard in.
+                 * @return The protected value of @p src.
+                 */
+		template <typename P>
+		P* protect(const std::atomic<P*>& src, size_t slot = 0)
+		{
+			P* p = src.load(std::memory_order_relaxed);
+			for (;;) {
+				rec->hazards[slot].store(
+					p, std::memory_order_seq_cst);
+				P* again = src.load(std::memory_order_acquire);
+				if (again == p) {
+					return p;
+				}
+				p = again;
+			}
+		}
+
+		/**
+                 * @brief Drops the hazard published in a slot.
+                 * @param slot The slot to clear.
+                 */
+		void clear(size_t slot)
+		{
+			rec->hazards[slot].store(nullptr,
+						 std::memory_order_release);
+		}
+
+	private:
+		Record* rec;
+	};
+
+	/**
+         * @brief Hands over an unlinked node to be freed once it is no longer
+         *        protected.
+         * @param p The unlinked node.
+         * @param deleter Function freeing the node.
+         */
+	static void retire(void* p, void (*deleter)(void*))
+	{
+		ThreadState& state = local();
+		state.retired.push_back(Retired(p, deleter));
+		if (state.retired.size() >= threshold()) {
+			scan(state.retired);
+		}
+	}
+
+	/**
+         * @brief Hands over an unlinked node to be deleted once it is no
+         *        longer protected.
+         * @param p The unlinked node, allocated with @c new.
+         */
+	template <typename P>
+	static void retire(P* p)
+	{
+		retire(p, &delete_as<P>);
+	}
+
+	/**
+         * @brief Frees every retired node of the calling thread, and of
+         *        exited threads, that is not protected right now.
+         */
+	static void collect() { scan(local().retired); }
+
+private:
+	static const size_t max_slots = 4;
+
+	/** @brief Hazard slots of one thread, never freed once created. */
+	struct Record {
+		std::atomic<bool> active;
+		std::atomic<void*> hazards[max_slots];
+		Record* next;
+
+		Record() : active(true), next(nullptr)
+		{
+			for (size_t i = 0; i < max_slots; i++) {
+				hazards[i].store(nullptr);
+			}
+		}
+	};
+
+	/** @brief A retired node together with the function to free it. */
+	struct Retired {
+		void* ptr;
+		void (*deleter)(void*);
+
+		Retired(void* p, void (*d)(void*)) : ptr(p), deleter(d) {}
+	};
+
+	/** @brief Process wide list of records and orphaned nodes. */
+	struct Domain {
+		std::atomic<Record*> head;
+		std::atomic<size_t> records;
+		std::mutex orphans_mtx;
+		std::vector<Retired> orphans;
+
+		Domain() : head(nullptr), records(0) {}
+
+		~Domain()
+		{
+			for (Retired& r : orphans) {
+				r.deleter(r.ptr);
+			}
+			Record* p = head.load();
+			while (p != nullptr) {
+				Record* next = p->next;
+				delete p;
+				p = next;
+			}
+		}
+
+		/** @brief Reuses an inactive record or links a new one. */
+		Record* acquire()
+		{
+			for (Record* p = head.load(std::memory_order_acquire);
+			     p != nullptr; p = p->next) {
+				bool idle = false;
+				if (p->active.compare_exchange_strong(idle,
+								      true)) {
+					return p;
+				}
+			}
+			Record* rec = new Record();
+			Record* old = head.load(std::memory_order_relaxed);
+			do {
+				rec->next = old;
+			} while (!head.compare_exchange_weak(
+				old, rec, std::memory_order_release,
+				std::memory_order_relaxed));
+			records.fetch_add(1, std::memory_order_relaxed);
+			return rec;
+		}
+	};
+
+	/** @brief Record and retired list of the calling thread. */
+	struct ThreadState {
+		Record* rec;
+		std::vector<Retired> retired;
+
+		ThreadState() : rec(nullptr) {}
+
+		/**
+                 * @brief Frees what can be freed and passes the rest on to
+                 *        the domain before giving up the record.
+                 */
+		~ThreadState()
+		{
+			if (!retired.empty()) {
+				scan(retired);
+			}
+			if (!retired.empty()) {
+				Domain& d = domain();
+				std::lock_guard<std::mutex> guard(
+					d.orphans_mtx);
+				d.orphans.insert(d.orphans.end(),
+						 retired.begin(),
+						 retired.end());
+			}
+			if (rec != nullptr) {
+				rec->active.store(false,
+						  std::memory_order_release);
+			}
+		}
+
+		Record* record()
+		{
+			if (rec == nullptr) {
+				rec = domain().acquire();
+			}
+			return rec;
+		}
+	};
+
+	static Domain& domain()
+	{
+		static Domain d;
+		return d;
+	}
+
+	static ThreadState& local()
+	{
+		static thread_local ThreadState state;
+		return state;
+	}
+
+	template <typename P>
+	static void delete_as(void* p)
+	{
+		delete static_cast<P*>(p);
+	}
+
+	/** @brief Retired list length at which a scan pays off. */
+	static size_t threshold()
+	{
+		size_t hazards = domain().records.load(
+					 std::memory_order_relaxed) *
+				 max_slots;
+		return 2 * hazards > 64 ? 2 * hazards : 64;
+	}
+
+	/**
+         * @brief Frees every node in @p retired that no slot protects.
+         *
+         * Also adopts the nodes left behind by exited threads.
+         */
+	static void scan(std::vector<Retired>& retired)
+	{
+		Domain& d = domain();
+		{
+			std::unique_lock<std::mutex> lock(d.orphans_mtx,
+							  std::try_to_lock);
+			if (lock.owns_lock() && !d.orphans.empty()) {
+				retired.insert(retired.end(), d.orphans.begin(),
+					       d.orphans.end());
+				d.orphans.clear();
+			}
+		}
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		std::vector<void*> hazards;
+		for (Record* p = d.head.load(std::memory_order_acquire);
+		     p != nullptr; p = p->next) {
+			for (size_t i = 0; i < max_slots; i++) {
+				void* h = p->hazards[i].load(
+					std::memory_order_acquire);
+				if (h != nullptr) {
+					hazards.push_back(h);
+				}
+			}
+		}
+		std::sort(hazards.begin(), hazards.end());
+		// Deleters may retire further nodes, so scan a detached list.
+		std::vector<Retired> todo;
+		todo.swap(retired);
+		for (Retired& r : todo) {
+			if (std::binary_search(hazards.begin(), hazards.end(),
+					       r.ptr)) {
+				retired.push_back(r);
+			} else {
+				r.deleter(r.ptr);
+			}
+		}
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_HAZARD_POINTERS_H
@@ -0,0 +1,477 @@
+#ifndef DATA_STRUCTURES_INTRUSIVE_LIST_H
+#define DATA_STRUCTURES_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace DataStructures {
+
+/**
+ * @class IntrusiveListHook
+ * @brief Links embedded in an object so it can be put in an
+ *        @ref IntrusiveList.
+ *
+ * An object needs one hook for every list it may be in at the same time.
+ * Copying an object does not copy its links: the copy starts out unlinked
+ * and assigning over a linked object keeps it where it is.
+ */
+class IntrusiveListHook {
+public:
+	IntrusiveListHook() : prev(nullptr), next(nullptr) {}
+
+	IntrusiveListHook(const IntrusiveListHook&)
+		: prev(nullptr), next(nullptr)
+	{
+	}
+
+	IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+	/**
+         * @brief Check if the hook is in a list.
+         * @return true if the owning object is linked through this hook.
+         */
+	bool is_linked() const { return next != nullptr; }
+
+private:
+	template <typename T, IntrusiveListHook T::*Hook>
+	friend class IntrusiveList;
+
+	IntrusiveListHook* prev;
+	IntrusiveListHook* next;
+};
+
+/**
+ * @class IntrusiveList
+ * @brief Doubly linked list threading through hooks embedded in its elements.
+ *
+ * The list never allocates or copies: it links the objects it is given
+ * through their @p Hook member and hands the same objects back. The caller
+ * owns the objects and has to keep them alive while they are linked. An
+ * element can be unlinked in O(1) given only a reference to it.
+ *
+ * The list is circular around a sentinel hook stored in the list itself,
+ * so an empty list holds no memory besides the object.
+ *
+ * @tparam T Type of the linked objects.
+ * @tparam Hook The member of @p T used by this list.
+ */
+template <typename T, IntrusiveListHook T::*Hook>
+class IntrusiveList {
+	template <bool IsConst>
+	class Iterator;
+
+public:
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+
+	/**
+         * @brief Constructor for an empty IntrusiveList.
+         */
+	IntrusiveList() : size(0) { root.prev = root.next = &root; }
+
+	/**
+         * @brief Destructor for the IntrusiveList class.
+         *
+         * Unlinks every element, leaving the objects themselves untouched.
+         */
+	~IntrusiveList() { clear(); }
+
+	IntrusiveList(const IntrusiveList&) = delete;
+	IntrusiveList& operator=(const IntrusiveList&) = delete;
+
+	/**
+         * @brief Move constructor, taking over the elements of another list
+         *        in O(1) and leaving it empty.
+         * @param other The list to move from.
+         */
+	IntrusiveList(IntrusiveList&& other) noexcept : IntrusiveList()
+	{
+		swap(other);
+	}
+
+	/**
+         * @brief Move assignment, unlinking the current elements and taking
+         *        over those of another list in O(1).
+         * @param other The list to move from, left empty.
+         * @return Reference to this list.
+         */
+	IntrusiveList& operator=(IntrusiveList&& other) noexcept
+	{
+		if (this != &other) {
+			clear();
+			swap(other);
+		}
+		return *this;
+	}
+
+	/* Add functions */
+	/**
+         * @brief Links an object at the start of the list.
+         * @param x The object, not linked through @p Hook yet.
+         * @throws std::invalid_argument if @p x is already linked.
+         */
+	void add_first(T& x) { link_before(root.next, hook(x)); }
+
+	/**
+         * @brief Links an object at the end of the list.
+         * @param x The object, not linked through @p Hook yet.
+         * @throws std::invalid_argument if @p x is already linked.
+         */
+	void add_last(T& x) { link_before(&root, hook(x)); }
+
+	/**
+         * @brief Links an object at a valid position index.
+         * @param pos_index Position index at which the object is to be
+         *                  linked.
+         * @param x The object, not linked through @p Hook yet.
+         * @throws std::out_of_range if @p pos_index is not in [0, size].
+         * @throws std::invalid_argument if @p x is already linked.
+         */
+	void add(int pos_index, T& x)
+	{
+		if (pos_index < 0 || pos_index > int(size)) {
+			throw std::out_of_range(
+				"Position Index: " + std::to_string(pos_index) +
+				", Size: " + std::to_string(size));
+		}
+		link_before(pos_index == int(size) ? &root
+						    : get_hook(pos_index),
+			    hook(x));
+	}
+
+	/**
+         * @brief Links an object right before another one.
+         * @param pos An object linked in this list.
+         * @param x The object, not linked through @p Hook yet.
+         * @throws std::invalid_argument if @p x is already linked.
+         */
+	void insert_before(T& pos, T& x) { link_before(hook(pos), hook(x)); }
+
+	/* Delete functions */
+	/**
+         * @brief Unlinks the first element.
+         * @return The unlinked object.
+         * @throws std::out_of_range if the list is empty. The exception
+         *         message states that there are "No elements to remove".
+         */
+	T& del_first()
+	{
+		check_not_empty("No elements to remove");
+		IntrusiveListHook* h = root.next;
+		unlink(h);
+		return owner(h);
+	}
+
+	/**
+         * @brief Unlinks the last element.
+         * @return The unlinked object.
+         * @throws std::out_of_range if the list is empty. The exception
+         *         message states that there are "No elements to remove".
+         */
+	T& del_last()
+	{
+		check_not_empty("No elements to remove");
+		IntrusiveListHook* h = root.prev;
+		unlink(h);
+		return owner(h);
+	}
+
+	/**
+         * @brief Unlinks the element at a particular index.
+         * @param index Index of the element.
+         * @return The unlinked object.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	T& del(int index)
+	{
+		IntrusiveListHook* h = get_hook(index);
+		unlink(h);
+		return owner(h);
+	}
+
+	/**
+         * @brief Unlinks an element given by reference in O(1).
+         * @param x An object linked in this list.
+         */
+	void remove(T& x) { unlink(hook(x)); }
+
+	/**
+         * @brief Unlinks every element, leaving the objects untouched.
+         */
+	void clear()
+	{
+		IntrusiveListHook* h = root.next;
+		while (h != &root) {
+			IntrusiveListHook* next = h->next;
+			h->prev = h->next = nullptr;
+			h = next;
+		}
+		root.prev = root.next = &root;
+		size = 0;
+	}
+
+	/* Get functions */
+	/**
+         * @brief Get the first element.
+         * @return The first element.
+         * @throws std::out_of_range when the list is empty. The exception
+         *         message states that there are "No nodes in the list".
+         */
+	T& get_first() const
+	{
+		check_not_empty("No nodes in the list");
+		return owner(root.next);
+	}
+
+	/**
+         * @brief Get the last element.
+         * @return The last element.
+         * @throws std::out_of_range when the list is empty. The exception
+         *         message states that there are "No nodes in the list".
+         */
+	T& get_last() const
+	{
+		check_not_empty("No nodes in the list");
+		return owner(root.prev);
+	}
+
+	/**
+         * @brief Get the element at a particular index.
+         * @param index Index of the element.
+         * @return The requested element.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	T& get(int index) const { return owner(get_hook(index)); }
+
+	/* Iterators */
+	/** @brief Iterator to the first element. */
+	iterator begin() { return iterator(root.next); }
+
+	/** @brief Iterator past the last element. */
+	iterator end() { return iterator(&root); }
+
+	/** @brief Const iterator to the first element. */
+	const_iterator begin() const { return const_iterator(root.next); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator end() const
+	{
+		return const_iterator(const_cast<IntrusiveListHook*>(&root));
+	}
+
+	/** @brief Const iterator to the first element. */
+	const_iterator cbegin() const { return begin(); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator cend() const { return end(); }
+
+	/**
+         * @brief Get an iterator to an element given by reference.
+         * @param x An object linked in this list.
+         * @return Iterator to @p x.
+         */
+	iterator iterator_to(T& x) { return iterator(hook(x)); }
+
+	/* Utility functions */
+	/**
+         * @brief Exchanges the elements of two lists in O(1).
+         * @param other The list to swap with.
+         */
+	void swap(IntrusiveList& other) noexcept
+	{
+		std::swap(root.prev, other.root.prev);
+		std::swap(root.next, other.root.next);
+		std::swap(size, other.size);
+		reroot();
+		other.reroot();
+	}
+
+	/**
+         * @brief Get the current size of the list.
+         * @return Current number of linked elements.
+         */
+	size_t get_size() const { return size; }
+
+	/**
+         * @brief Check if the list is empty.
+         * @return true if the list contains no elements, false otherwise.
+         */
+	bool is_empty() const { return size == 0; }
+
+private:
+	/** Sentinel, before the first and after the last element. */
+	IntrusiveListHook root;
+	/** Current number of linked elements. */
+	size_t size;
+
+	static IntrusiveListHook* hook(T& x) { return &(x.*Hook); }
+
+	/**
+         * @brief Points the neighbours of the sentinel back at it after its
+         *        links were swapped with another list.
+         */
+	void reroot()
+	{
+		if (size == 0) {
+			root.prev = root.next = &root;
+		} else {
+			root.next->prev = &root;
+			root.prev->next = &root;
+		}
+	}
+
+	/**
+         * @brief Get the object a hook is embedded in.
+         *
+         * The offset of the hook within @p T is measured once on raw
+         * storage of the right size and alignment.
+         */
+	static T& owner(IntrusiveListHook* h)
+	{
+		static const std::ptrdiff_t offset = hook_offset();
+		return *reinterpret_cast<T*>(reinterpret_cast<char*>(h) -
+					     offset);
+	}
+
+	static std::ptrdiff_t hook_offset()
+	{
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type buf;
+		T* p = reinterpret_cast<T*>(&buf);
+		return reinterpret_cast<char*>(&(p->*Hook)) -
+		       reinterpret_cast<char*>(p);
+	}
+
+	void link_before(IntrusiveListHook* pos, IntrusiveListHook* h)
+	{
+		if (h->is_linked()) {
+			throw std::invalid_argument(
+				"Element is already linked");
+		}
+		h->prev = pos->prev;
+		h->next = pos;
+		pos->prev->next = h;
+		pos->prev = h;
+		size++;
+	}
+
+	void unlink(IntrusiveListHook* h)
+	{
+		h->prev->next = h->next;
+		h->next->prev = h->prev;
+		h->prev = h->next = nullptr;
+		size--;
+	}
+
+	/**
+         * @brief Get the hook of the element at an index, walking from the
+         *        nearer end.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	IntrusiveListHook* get_hook(int index) const
+	{
+		if (index < 0 || index >= int(size)) {
+			throw std::out_of_range(
+				"Element Index: " + std::to_string(index) +
+				", Size: " + std::to_string(size));
+		}
+		IntrusiveListHook* p;
+		if (index < int(size) / 2) {
+			p = root.next;
+			for (int i = 0; i < index; i++) {
+				p = p->next;
+			}
+		} else {
+			p = root.prev;
+			for (int i = int(size) - 1; i > index; i--) {
+				p = p->prev;
+			}
+		}
+		return p;
+	}
+
+	void check_not_empty(const char* message) const
+	{
+		if (is_empty()) {
+			throw std::out_of_range(message);
+		}
+	}
+};
+
+/**
+ * @brief Bidirectional iterator over an IntrusiveList, yielding the linked
+ *        objects.
+ */
+template <typename T, IntrusiveListHook T::*Hook>
+template <bool IsConst>
+class IntrusiveList<T, Hook>::Iterator {
+public:
+	typedef std::bidirectional_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+	typedef typename std::conditional<IsConst, const T&, T&>::type
+		reference;
+
+	Iterator() : cur(nullptr) {}
+
+	explicit Iterator(IntrusiveListHook* h) : cur(h) {}
+
+	// Allows an iterator to be passed where a const_iterator is expected.
+	template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+	Iterator(const Iterator<false>& other) : cur(other.cur)
+	{
+	}
+
+	reference operator*() const { return owner(cur); }
+
+	pointer operator->() const { return &owner(cur); }
+
+	Iterator& operator++()
+	{
+		cur = cur->next;
+		return *this;
+	}
+
+	Iterator operator++(int)
+	{
+		Iterator old = *this;
+		cur = cur->next;
+		return old;
+	}
+
+	Iterator& operator--()
+	{
+		cur = cur->prev;
+		return *this;
+	}
+
+	Iterator operator--(int)
+	{
+		Iterator old = *this;
+		cur = cur->prev;
+		return old;
+	}
+
+	bool operator==(const Iterator& other) const
+	{
+		return cur == other.cur;
+	}
+
+	bool operator!=(const Iterator& other) const
+	{
+		return cur != other.cur;
+	}
+
+private:
+	friend class Iterator<!IsConst>;
+
+	IntrusiveListHook* cur;
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_INTRUSIVE_LIST_H
@@ -0,0 +1,425 @@
+#ifndef DATA_STRUCTURES_LFU_CACHE_H
+#define DATA_STRUCTURES_LFU_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "hash_index.h"
+#include "lru_cache.h"
+
+namespace DataStructures {
+
+/**
+ * @class LFUCache
+ * @brief Cache of bounded weight evicting the least frequently used entry,
+ *        and of those the least recently used one.
+ *
+ * Follows the constant time scheme of Shah, Mitra and Matani: there is one
+ * bucket per distinct use count, the buckets form a list in increasing
+ * order of their counts, and every bucket holds a list of its entries from
+ * the least to the most recently used. A hit moves its entry to the bucket
+ * of the next count, creating it right after the current one if it does
+ * not exist yet, and the victim of an eviction is always the first entry
+ * of the first bucket. Looking up, inserting and evicting thus take O(1)
+ * expected time.
+ *
+ * As in @ref LRUCache the entries are kept densely in one array, linked by
+ * 32-bit indices and found through a @ref HashIndex, and the capacity
+ * bounds their total weight given by @p Weigher.
+ *
+ * @tparam K Type of the keys.
+ * @tparam V Type of the values.
+ * @tparam Hash Hash function of the keys.
+ * @tparam Weigher Function giving the weight of a key and value.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>,
+	  typename Weigher = UnitWeigher>
+class LFUCache {
+public:
+	/**
+         * @brief Constructor for an empty LFUCache.
+         * @param capacity The largest total weight of the entries.
+         * @param hash The hash function of the keys.
+         * @param weigher The function giving the weight of an entry.
+         */
+	explicit LFUCache(size_t capacity, const Hash& hash = Hash(),
+			  const Weigher& weigher = Weigher())
+		: hasher(hash)
+		, weigh(weigher)
+		, cap(capacity)
+		, weight(0)
+		, first_bucket(npos)
+		, free_bucket(npos)
+	{
+	}
+
+	/**
+         * @brief Looks up a key, counting a use of its entry.
+         * @param key The key to look up.
+         * @param value Set to the value of the key if it is cached.
+         * @return true on a hit, false on a miss.
+         */
+	bool get(const K& key, V& value)
+	{
+		uint32_t e = find(key, HashIndex::fold(hasher(key)));
+		if (e == npos) {
+			stats.misses++;
+			return false;
+		}
+		stats.hits++;
+		touch(e);
+		value = entries[e].value;
+		return true;
+	}
+
+	/**
+         * @brief Inserts or updates an entry and evicts entries until the
+         *        total weight fits the capacity again.
+         *
+         * Updating counts as a use of the entry. A new entry starts with one
+         * use, and is never the one evicted to make room for itself.
+         *
+         * @param key The key.
+         * @param value The value.
+         * @return true if the entry is cached, false if it alone is heavier
+         *         than the capacity, in which case any old entry of the key
+         *         is removed as well.
+         */
+	bool put(const K& key, const V& value)
+	{
+		size_t w = weigh(key, value);
+		uint32_t h = HashIndex::fold(hasher(key));
+		uint32_t e = find(key, h);
+		if (w > cap) {
+			if (e != npos) {
+				remove(e);
+			}
+			return false;
+		}
+		if (e != npos) {
+			Entry& x = entries[e];
+			weight = weight - x.weight + w;
+			x.value = value;
+			x.weight = w;
+			touch(e);
+			evict_until_fits(e);
+			return true;
+		}
+		// Evict before inserting, so that the newcomer, which would sit
+		// in the first bucket, is not its own victim.
+		if (entries.size() == npos) {
+			throw std::length_error("LFUCache is too large");
+		}
+		weight += w;
+		evict_until_fits(npos);
+		e = uint32_t(entries.size());
+		entries.push_back(Entry(key, value, w, h));
+		index.insert(h, e);
+		uint32_t b = first_bucket;
+		if (b == npos || buckets[b].count != 1) {
+			b = new_bucket(1, npos, first_bucket);
+		}
+		append(b, e);
+		return true;
+	}
+
+	/**
+         * @brief Removes the entry of a key.
+         * @param key The key.
+         * @return true if the key was cached.
+         */
+	bool erase(const K& key)
+	{
+		uint32_t e = find(key, HashIndex::fold(hasher(key)));
+		if (e == npos) {
+			return false;
+		}
+		remove(e);
+		return true;
+	}
+
+	/**
+         * @brief Checks for a key without counting a lookup or a use.
+         * @param key The key.
+         * @return true if the key is cached.
+         */
+	bool contains(const K& key) const
+	{
+		return find(key, HashIndex::fold(hasher(key))) != npos;
+	}
+
+	/**
+         * @brief Get the number of uses counted for a key.
+         * @param key The key.
+         * @return The use count, zero if the key is not cached.
+         */
+	uint64_t use_count(const K& key) const
+	{
+		uint32_t e = find(key, HashIndex::fold(hasher(key)));
+		return e == npos ? 0 : buckets[entries[e].bucket].count;
+	}
+
+	/**
+         * @brief Removes every entry, keeping the counters.
+         */
+	void clear()
+	{
+		std::vector<Entry>().swap(entries);
+		std::vector<Bucket>().swap(buckets);
+		index.clear();
+		weight = 0;
+		first_bucket = free_bucket = npos;
+	}
+
+	/**
+         * @brief Get the counters of lookups and evictions.
+         * @return The counters.
+         */
+	const CacheStats& get_stats() const { return stats; }
+
+	/**
+         * @brief Sets every counter back to zero.
+         */
+	void reset_stats() { stats = CacheStats(); }
+
+	/**
+         * @brief Get the number of cached entries.
+         * @return Number of entries.
+         */
+	size_t get_size() const { return entries.size(); }
+
+	/**
+         * @brief Get the total weight of the cached entries.
+         * @return Total weight, at most the capacity.
+         */
+	size_t get_weight() const { return weight; }
+
+	/**
+         * @brief Get the largest total weight of the entries.
+         * @return The capacity.
+         */
+	size_t get_capacity() const { return cap; }
+
+	/**
+         * @brief Check if the cache is empty.
+         * @return true if no entry is cached, false otherwise.
+         */
+	bool is_empty() const { return entries.empty(); }
+
+private:
+	/** Index standing for no entry or bucket, ending the lists. */
+	static const uint32_t npos = HashIndex::npos;
+
+	/** @brief A cached key and value with its links in its bucket. */
+	struct Entry {
+		K key;
+		V value;
+		/** Weight of the entry given by the weigher. */
+		size_t weight;
+		/** Folded hash of the key. */
+		uint32_t hash;
+		/** Bucket holding the entry. */
+		uint32_t bucket;
+		/** Index of the next less recently used entry in the bucket. */
+		uint32_t prev;
+		/** Index of the next more recently used entry in the bucket. */
+		uint32_t next;
+
+		Entry(const K& k, const V& v, size_t w, uint32_t h)
+			: key(k), value(v), weight(w), hash(h), bucket(npos)
+			, prev(npos), next(npos)
+		{
+		}
+	};
+
+	/** @brief The entries used a given number of times. */
+	struct Bucket {
+		/** The use count of the entries. */
+		uint64_t count;
+		/** Bucket of the next smaller count. */
+		uint32_t prev;
+		/** Bucket of the next larger count, or the next free bucket. */
+		uint32_t next;
+		/** Least recently used entry. */
+		uint32_t first;
+		/** Most recently used entry. */
+		uint32_t last;
+	};
+
+	Hash hasher;
+	Weigher weigh;
+	/** Largest total weight. */
+	size_t cap;
+	/** Total weight of the entries. */
+	size_t weight;
+	/** The entries, in no particular order. */
+	std::vector<Entry> entries;
+	/** The buckets, in use or on the free list. */
+	std::vector<Bucket> buckets;
+	/** Maps the keys to their entries. */
+	HashIndex index;
+	/** Bucket of the smallest use count. */
+	uint32_t first_bucket;
+	/** First unused bucket. */
+	uint32_t free_bucket;
+	/** Lookup and eviction counters. */
+	CacheStats stats;
+
+	uint32_t find(const K& key, uint32_t h) const
+	{
+		return index.find(h, [this, &key](uint32_t e) {
+			return entries[e].key == key;
+		});
+	}
+
+	/**
+         * @brief Links a new bucket in between @p prev and @p next.
+         * @return Index of the new bucket.
+         */
+	uint32_t new_bucket(uint64_t count, uint32_t prev, uint32_t next)
+	{
+		uint32_t b = free_bucket;
+		if (b != npos) {
+			free_bucket = buckets[b].next;
+		} else {
+			b = uint32_t(buckets.size());
+			buckets.push_back(Bucket());
+		}
+		buckets[b] = Bucket{count, prev, next, npos, npos};
+		if (prev == npos) {
+			first_bucket = b;
+		} else {
+			buckets[prev].next = b;
+		}
+		if (next != npos) {
+			buckets[next].prev = b;
+		}
+		return b;
+	}
+
+	/** @brief Unlinks an empty bucket and puts it onto the free list. */
+	void release_bucket(uint32_t b)
+	{
+		Bucket& x = buckets[b];
+		if (x.prev == npos) {
+			first_bucket = x.next;
+		} else {
+			buckets[x.prev].next = x.next;
+		}
+		if (x.next != npos) {
+			buckets[x.next].prev = x.prev;
+		}
+		x.next = free_bucket;
+		free_bucket = b;
+	}
+
+	/** @brief Links entry @p e in as the most recent one of bucket @p b. */
+	void append(uint32_t b, uint32_t e)
+	{
+		Bucket& x = buckets[b];
+		entries[e].bucket = b;
+		entries[e].prev = x.last;
+		entries[e].next = npos;
+		if (x.last == npos) {
+			x.first = e;
+		} else {
+			entries[x.last].next = e;
+		}
+		x.last = e;
+	}
+
+	/** @brief Unlinks entry @p e from its bucket, keeping the bucket. */
+	void unlink(uint32_t e)
+	{
+		Entry& x = entries[e];
+		Bucket& b = buckets[x.bucket];
+		if (x.prev == npos) {
+			b.first = x.next;
+		} else {
+			entries[x.prev].next = x.next;
+		}
+		if (x.next == npos) {
+			b.last = x.prev;
+		} else {
+			entries[x.next].prev = x.prev;
+		}
+	}
+
+	/** @brief Moves entry @p e to the bucket of the next use count. */
+	void touch(uint32_t e)
+	{
+		uint32_t b = entries[e].bucket;
+		uint64_t count = buckets[b].count + 1;
+		uint32_t next = buckets[b].next;
+		if (next == npos || buckets[next].count != count) {
+			next = new_bucket(count, b, next);
+		}
+		unlink(e);
+		append(next, e);
+		if (buckets[b].first == npos) {
+			release_bucket(b);
+		}
+	}
+
+	/**
+         * @brief Evicts the least frequently used entries, other than
+         *        @p keep, until the total weight fits the capacity.
+         */
+	void evict_until_fits(uint32_t keep)
+	{
+		while (weight > cap) {
+			uint32_t b = first_bucket;
+			uint32_t victim = buckets[b].first;
+			if (victim == keep) {
+				victim = entries[victim].next;
+				if (victim == npos) {
+					victim = buckets[buckets[b].next].first;
+				}
+			}
+			remove(victim);
+			stats.evictions++;
+		}
+	}
+
+	/**
+         * @brief Removes entry @p e and moves the last entry of the array
+         *        into its place, pointing its neighbours, its bucket and its
+         *        slot in the index at the new position.
+         */
+	void remove(uint32_t e)
+	{
+		uint32_t b = entries[e].bucket;
+		unlink(e);
+		if (buckets[b].first == npos) {
+			release_bucket(b);
+		}
+		index.erase(entries[e].hash, e);
+		weight -= entries[e].weight;
+		uint32_t last = uint32_t(entries.size() - 1);
+		if (e != last) {
+			Entry& x = entries[last];
+			Bucket& xb = buckets[x.bucket];
+			if (x.prev == npos) {
+				xb.first = e;
+			} else {
+				entries[x.prev].next = e;
+			}
+			if (x.next == npos) {
+				xb.last = e;
+			} else {
+				entries[x.next].prev = e;
+			}
+			index.relocate(x.hash, last, e);
+			entries[e] = std::move(x);
+		}
+		entries.pop_back();
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_LFU_CACHE_H
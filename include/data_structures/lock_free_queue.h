@@ -0,0 +1,328 @@
+#ifndef DATA_STRUCTURES_LOCK_FREE_QUEUE_H
+#define DATA_STRUCTURES_LOCK_FREE_QUEUE_H
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#include "hazard_pointers.h"
+
+namespace DataStructures {
+
+/**
+ * @class LockFreeQueue
+ * @brief Michael-Scott lock-free unbounded FIFO queue.
+ *
+ * A singly linked list with a dummy node at the head. Producers link new
+ * nodes after the tail with compare-and-swap and consumers swing the head
+ * forward, the node that was the first element becoming the new dummy. A
+ * lagging tail is helped forward by whichever thread notices it, so no
+ * thread ever waits for another.
+ *
+ * The dequeued dummy is handed to the @p Reclaimer. Once it is safe it is
+ * not freed but pushed onto a small node cache of the thread doing the
+ * reclamation, from which later pushes on that thread take their nodes. As
+ * producers and consumers are usually different threads, a full cache hands
+ * its nodes as one batch to a shared depot and an empty cache takes a whole
+ * batch back, so the depot lock is taken once per batch. After a warm-up the
+ * queue thus runs without calling @c new or @c delete.
+ *
+ * @tparam T Type of the implementation class.
+ * @tparam Reclaimer Memory reclamation policy, see @ref HazardPointers for
+ *                   the interface it has to provide.
+ */
+template <typename T, typename Reclaimer = HazardPointers>
+class LockFreeQueue {
+public:
+	/**
+         * @brief Constructor for an empty LockFreeQueue.
+         */
+	LockFreeQueue()
+	{
+		Node* dummy = allocate();
+		head.store(dummy, std::memory_order_relaxed);
+		tail.store(dummy, std::memory_order_relaxed);
+	}
+
+	/**
+         * @brief Destructor for the LockFreeQueue class.
+         *
+         * Destroys the remaining elements and returns the nodes to the
+         * cache of the calling thread. No thread may be using the queue
+         * anymore.
+         */
+	~LockFreeQueue()
+	{
+		Node* p = head.load(std::memory_order_relaxed);
+		Node* next = p->next.load(std::memory_order_relaxed);
+		recycle(p);
+		while (next != nullptr) {
+			p = next;
+			next = p->next.load(std::memory_order_relaxed);
+			p->value()->~T();
+			recycle(p);
+		}
+	}
+
+	LockFreeQueue(const LockFreeQueue&) = delete;
+	LockFreeQueue& operator=(const LockFreeQueue&) = delete;
+
+	/**
+         * @brief Pushes the element at the back of the queue.
+         * @param element The element to be pushed.
+         */
+	void push(const T& element)
+	{
+		Node* x = allocate();
+		try {
+			new (x->storage) T(element);
+		} catch (...) {
+			recycle(x);
+			throw;
+		}
+		typename Reclaimer::Guard guard;
+		for (;;) {
+			Node* last = guard.protect(tail, 0);
+			Node* next = last->next.load(std::memory_order_acquire);
+			if (last != tail.load(std::memory_order_acquire)) {
+				continue;
+			}
+			if (next != nullptr) {
+				// Another push linked its node but has not
+				// moved the tail yet, help it along.
+				tail.compare_exchange_weak(
+					last, next, std::memory_order_release,
+					std::memory_order_relaxed);
+				continue;
+			}
+			if (last->next.compare_exchange_weak(
+				    next, x, std::memory_order_release,
+				    std::memory_order_relaxed)) {
+				tail.compare_exchange_strong(
+					last, x, std::memory_order_release,
+					std::memory_order_relaxed);
+				return;
+			}
+		}
+	}
+
+	/**
+         * @brief Pops the element at the front of the queue.
+         *
+         * Only the thread whose compare-and-swap moves the head reads the
+         * value out of the new dummy, which it keeps protected until then.
+         *
+         * @param out Receives the popped element.
+         * @return true if an element was popped, false if the queue was
+         *         empty.
+         */
+	bool pop(T& out)
+	{
+		typename Reclaimer::Guard guard;
+		for (;;) {
+			Node* first = guard.protect(head, 0);
+			Node* last = tail.load(std::memory_order_acquire);
+			Node* next = guard.protect(first->next, 1);
+			if (first != head.load(std::memory_order_acquire)) {
+				continue;
+			}
+			if (next == nullptr) {
+				return false;
+			}
+			if (first == last) {
+				tail.compare_exchange_weak(
+					last, next, std::memory_order_release,
+					std::memory_order_relaxed);
+				continue;
+			}
+			if (head.compare_exchange_weak(
+				    first, next, std::memory_order_acquire,
+				    std::memory_order_relaxed)) {
+				out = std::move(*next->value());
+				next->value()->~T();
+				guard.clear(0);
+				guard.clear(1);
+				Reclaimer::retire(first, &recycle_erased);
+				return true;
+			}
+		}
+	}
+
+	/**
+         * @brief Check if the queue is empty.
+         * @return true if the queue had no elements at the time of the call.
+         */
+	bool is_empty() const
+	{
+		typename Reclaimer::Guard guard;
+		Node* first = guard.protect(head, 0);
+		return first->next.load(std::memory_order_acquire) == nullptr;
+	}
+
+private:
+	/**
+         * @brief Struct representing a node in the queue.
+         *
+         * The element is constructed in place in @ref storage, so that a
+         * dummy node holds no live element and the node itself can be
+         * recycled as plain memory.
+         */
+	struct Node {
+		/** Pointer to the next node. */
+		std::atomic<Node*> next;
+		/** Raw storage for the element. */
+		alignas(T) unsigned char storage[sizeof(T)];
+
+		T* value() { return reinterpret_cast<T*>(storage); }
+	};
+
+	/** @brief Free nodes of one thread, linked through their next. */
+	struct NodeCache {
+		Node* free;
+		size_t count;
+
+		NodeCache() : free(nullptr), count(0) {}
+
+		/** @brief Gives the remaining nodes to the depot. */
+		~NodeCache()
+		{
+			if (free != nullptr) {
+				give_back(free, count);
+			}
+			cache_gone() = true;
+		}
+	};
+
+	/** @brief Batches of free nodes shared between all threads. */
+	struct Depot {
+		std::mutex mtx;
+		std::vector<std::pair<Node*, size_t>> batches;
+
+		~Depot()
+		{
+			for (std::pair<Node*, size_t>& b : batches) {
+				delete_chain(b.first);
+			}
+			depot_gone() = true;
+		}
+
+		void put(Node* chain, size_t count)
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			batches.push_back(std::make_pair(chain, count));
+		}
+
+		/** @return false if there was no batch to take. */
+		bool take(NodeCache& c)
+		{
+			std::lock_guard<std::mutex> lock(mtx);
+			if (batches.empty()) {
+				return false;
+			}
+			c.free = batches.back().first;
+			c.count = batches.back().second;
+			batches.pop_back();
+			return true;
+		}
+	};
+
+	/** Number of nodes kept in a thread's cache and moved per batch. */
+	static const size_t cache_limit = 256;
+
+	/** The dummy node, whose successor is the front element. */
+	alignas(64) std::atomic<Node*> head;
+	/** The last or, transiently, second to last node. */
+	alignas(64) std::atomic<Node*> tail;
+
+	static Depot& depot()
+	{
+		static Depot d;
+		return d;
+	}
+
+	static NodeCache& cache()
+	{
+		static thread_local NodeCache c;
+		return c;
+	}
+
+	/**
+         * @brief Whether the cache of the calling thread has already been
+         *        destroyed, as happens for nodes reclaimed during exit.
+         */
+	static bool& cache_gone()
+	{
+		static thread_local bool gone = false;
+		return gone;
+	}
+
+	/**
+         * @brief Whether the depot has already been destroyed, as happens
+         *        for nodes a reclaimer frees during static destruction.
+         */
+	static bool& depot_gone()
+	{
+		static bool gone = false;
+		return gone;
+	}
+
+	static void delete_chain(Node* p)
+	{
+		while (p != nullptr) {
+			Node* next = p->next.load(std::memory_order_relaxed);
+			delete p;
+			p = next;
+		}
+	}
+
+	/** @brief Hands a chain of free nodes to the depot, if still there. */
+	static void give_back(Node* chain, size_t count)
+	{
+		if (depot_gone()) {
+			delete_chain(chain);
+		} else {
+			depot().put(chain, count);
+		}
+	}
+
+	static Node* allocate()
+	{
+		Node* x;
+		NodeCache& c = cache();
+		if (c.free != nullptr || (!depot_gone() && depot().take(c))) {
+			x = c.free;
+			c.free = x->next.load(std::memory_order_relaxed);
+			c.count--;
+		} else {
+			x = new Node;
+		}
+		x->next.store(nullptr, std::memory_order_relaxed);
+		return x;
+	}
+
+	static void recycle(Node* x)
+	{
+		if (cache_gone()) {
+			x->next.store(nullptr, std::memory_order_relaxed);
+			give_back(x, 1);
+			return;
+		}
+		NodeCache& c = cache();
+		if (c.count >= cache_limit) {
+			give_back(c.free, c.count);
+			c.free = nullptr;
+			c.count = 0;
+		}
+		x->next.store(c.free, std::memory_order_relaxed);
+		c.free = x;
+		c.count++;
+	}
+
+	static void recycle_erased(void* p) { recycle(static_cast<Node*>(p)); }
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_LOCK_FREE_QUEUE_H
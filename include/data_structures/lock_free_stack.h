@@ -0,0 +1,126 @@
+#ifndef DATA_STRUCTURES_LOCK_FREE_STACK_H
+#define DATA_STRUCTURES_LOCK_FREE_STACK_H
+
+#include <atomic>
+#include <utility>
+
+#include "hazard_pointers.h"
+
+namespace DataStructures {
+
+/**
+ * @class LockFreeStack
+ * @brief Treiber lock-free stack with pluggable memory reclamation.
+ *
+ * A singly linked list whose head is swung with compare-and-swap, so any
+ * number of threads can push and pop concurrently. Each node carries a
+ * single pointer and there is no sentinel.
+ *
+ * A popped node may still be read by threads that loaded it as the head
+ * just before, so it is handed to the @p Reclaimer instead of being deleted.
+ * The reclaimer also keeps a popped node from being freed and reused at the
+ * same address while another thread is about to compare against it, which
+ * is what makes the head compare-and-swap safe from ABA.
+ *
+ * @tparam T Type of the implementation class.
+ * @tparam Reclaimer Memory reclamation policy, see @ref HazardPointers for
+ *                   the interface it has to provide.
+ */
+template <typename T, typename Reclaimer = HazardPointers>
+class LockFreeStack {
+public:
+	/**
+         * @brief Constructor for an empty LockFreeStack.
+         */
+	LockFreeStack() : head(nullptr) {}
+
+	/**
+         * @brief Destructor for the LockFreeStack class.
+         *
+         * Deletes the remaining nodes. No thread may be using the stack
+         * anymore.
+         */
+	~LockFreeStack()
+	{
+		Node* p = head.load(std::memory_order_relaxed);
+		while (p != nullptr) {
+			Node* next = p->next;
+			delete p;
+			p = next;
+		}
+	}
+
+	LockFreeStack(const LockFreeStack&) = delete;
+	LockFreeStack& operator=(const LockFreeStack&) = delete;
+
+	/**
+         * @brief Push an element onto the top of the stack.
+         * @param element The element to push.
+         */
+	void push(const T& element)
+	{
+		Node* x = new Node(element);
+		x->next = head.load(std::memory_order_relaxed);
+		while (!head.compare_exchange_weak(x->next, x,
+						   std::memory_order_release,
+						   std::memory_order_relaxed)) {
+		}
+	}
+
+	/**
+         * @brief Pop the element at the top of the stack.
+         *
+         * The head is protected before it is dereferenced. Only the thread
+         * whose compare-and-swap unlinks the node reads its value, after which
+         * the node is retired.
+         *
+         * @param out Receives the popped element.
+         * @return true if an element was popped, false if the stack was empty.
+         */
+	bool pop(T& out)
+	{
+		typename Reclaimer::Guard guard;
+		for (;;) {
+			Node* top = guard.protect(head);
+			if (top == nullptr) {
+				return false;
+			}
+			Node* next = top->next;
+			if (head.compare_exchange_weak(
+				    top, next, std::memory_order_acquire,
+				    std::memory_order_relaxed)) {
+				out = std::move(top->data);
+				guard.clear(0);
+				Reclaimer::retire(top);
+				return true;
+			}
+		}
+	}
+
+	/**
+         * @brief Check if the stack is empty.
+         * @return true if the stack had no elements at the time of the call.
+         */
+	bool is_empty() const
+	{
+		return head.load(std::memory_order_acquire) == nullptr;
+	}
+
+private:
+	/** @brief Struct representing a node in the stack. */
+	struct Node {
+		/** The data stored in the node. */
+		T data;
+		/** Pointer to the node below, immutable once pushed. */
+		Node* next;
+
+		explicit Node(const T& val) : data(val), next(nullptr) {}
+	};
+
+	/** The node at the top of the stack. */
+	std::atomic<Node*> head;
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_LOCK_FREE_STACK_H
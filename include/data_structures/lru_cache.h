@@ -0,0 +1,337 @@
+#ifndef DATA_STRUCTURES_LRU_CACHE_H
+#define DATA_STRUCTURES_LRU_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "hash_index.h"
+
+namespace DataStructures {
+
+/**
+ * @brief Hit, miss and eviction counters of a cache.
+ */
+struct CacheStats {
+	/** Lookups that found their key. */
+	size_t hits = 0;
+	/** Lookups that did not find their key. */
+	size_t misses = 0;
+	/** Entries removed to make room for others. */
+	size_t evictions = 0;
+};
+
+/**
+ * @brief Weigher giving every cache entry the weight one, so that the
+ *        capacity of a cache counts entries.
+ */
+struct UnitWeigher {
+	template <typename K, typename V>
+	size_t operator()(const K&, const V&) const
+	{
+		return 1;
+	}
+};
+
+/**
+ * @class LRUCache
+ * @brief Cache of bounded weight evicting the least recently used entry.
+ *
+ * Entries are kept next to each other in one array and are threaded onto
+ * a doubly linked recency list by 32-bit indices, the most recently used
+ * entry first. A @ref HashIndex maps keys to entries. Looking up, inserting
+ * and evicting all take O(1) expected time. When an entry is removed the
+ * last entry of the array is moved into its place, so the array stays
+ * dense and neither keys nor values need to be default constructible.
+ *
+ * Every entry has a weight given by @p Weigher, and entries are evicted
+ * until the total weight fits the capacity. With the default
+ * @ref UnitWeigher the capacity is a number of entries, a weigher
+ * returning the size of the value makes it a number of bytes.
+ *
+ * @tparam K Type of the keys.
+ * @tparam V Type of the values.
+ * @tparam Hash Hash function of the keys.
+ * @tparam Weigher Function giving the weight of a key and value.
+ */
+template <typename K, typename V, typename Hash = std::hash<K>,
+	  typename Weigher = UnitWeigher>
+class LRUCache {
+public:
+	/**
+         * @brief Constructor for an empty LRUCache.
+         * @param capacity The largest total weight of the entries.
+         * @param hash The hash function of the keys.
+         * @param weigher The function giving the weight of an entry.
+         */
+	explicit LRUCache(size_t capacity, const Hash& hash = Hash(),
+			  const Weigher& weigher = Weigher())
+		: hasher(hash)
+		, weigh(weigher)
+		, cap(capacity)
+		, weight(0)
+		, head(npos)
+		, tail(npos)
+	{
+	}
+
+	/**
+         * @brief Looks up a key, making its entry the most recently used.
+         * @param key The key to look up.
+         * @param value Set to the value of the key if it is cached.
+         * @return true on a hit, false on a miss.
+         */
+	bool get(const K& key, V& value)
+	{
+		uint32_t e = find(key);
+		if (e == npos) {
+			stats.misses++;
+			return false;
+		}
+		stats.hits++;
+		touch(e);
+		value = entries[e].value;
+		return true;
+	}
+
+	/**
+         * @brief Inserts or updates an entry, making it the most recently
+         *        used, and evicts least recently used entries until the
+         *        total weight fits the capacity again.
+         * @param key The key.
+         * @param value The value.
+         * @return true if the entry is cached, false if it alone is heavier
+         *         than the capacity, in which case any old entry of the key
+         *         is removed as well.
+         */
+	bool put(const K& key, const V& value)
+	{
+		size_t w = weigh(key, value);
+		uint32_t h = HashIndex::fold(hasher(key));
+		uint32_t e = find(key, h);
+		if (w > cap) {
+			if (e != npos) {
+				remove(e);
+			}
+			return false;
+		}
+		if (e != npos) {
+			Entry& x = entries[e];
+			weight = weight - x.weight + w;
+			x.value = value;
+			x.weight = w;
+			touch(e);
+		} else {
+			if (entries.size() == npos) {
+				throw std::length_error(
+					"LRUCache is too large");
+			}
+			e = uint32_t(entries.size());
+			entries.push_back(Entry(key, value, w, h));
+			index.insert(h, e);
+			link_front(e);
+			weight += w;
+		}
+		while (weight > cap) {
+			remove(tail);
+			stats.evictions++;
+		}
+		return true;
+	}
+
+	/**
+         * @brief Removes the entry of a key.
+         * @param key The key.
+         * @return true if the key was cached.
+         */
+	bool erase(const K& key)
+	{
+		uint32_t e = find(key);
+		if (e == npos) {
+			return false;
+		}
+		remove(e);
+		return true;
+	}
+
+	/**
+         * @brief Checks for a key without counting a lookup or changing the
+         *        recency of its entry.
+         * @param key The key.
+         * @return true if the key is cached.
+         */
+	bool contains(const K& key) const { return find(key) != npos; }
+
+	/**
+         * @brief Removes every entry, keeping the counters.
+         */
+	void clear()
+	{
+		std::vector<Entry>().swap(entries);
+		index.clear();
+		weight = 0;
+		head = tail = npos;
+	}
+
+	/**
+         * @brief Get the counters of lookups and evictions.
+         * @return The counters.
+         */
+	const CacheStats& get_stats() const { return stats; }
+
+	/**
+         * @brief Sets every counter back to zero.
+         */
+	void reset_stats() { stats = CacheStats(); }
+
+	/**
+         * @brief Get the number of cached entries.
+         * @return Number of entries.
+         */
+	size_t get_size() const { return entries.size(); }
+
+	/**
+         * @brief Get the total weight of the cached entries.
+         * @return Total weight, at most the capacity.
+         */
+	size_t get_weight() const { return weight; }
+
+	/**
+         * @brief Get the largest total weight of the entries.
+         * @return The capacity.
+         */
+	size_t get_capacity() const { return cap; }
+
+	/**
+         * @brief Check if the cache is empty.
+         * @return true if no entry is cached, false otherwise.
+         */
+	bool is_empty() const { return entries.empty(); }
+
+private:
+	/** Index standing for no entry, ending the recency list. */
+	static const uint32_t npos = HashIndex::npos;
+
+	/** @brief A cached key and value with its recency links. */
+	struct Entry {
+		K key;
+		V value;
+		/** Weight of the entry given by the weigher. */
+		size_t weight;
+		/** Folded hash of the key. */
+		uint32_t hash;
+		/** Index of the next more recently used entry. */
+		uint32_t prev;
+		/** Index of the next less recently used entry. */
+		uint32_t next;
+
+		Entry(const K& k, const V& v, size_t w, uint32_t h)
+			: key(k), value(v), weight(w), hash(h), prev(npos)
+			, next(npos)
+		{
+		}
+	};
+
+	Hash hasher;
+	Weigher weigh;
+	/** Largest total weight. */
+	size_t cap;
+	/** Total weight of the entries. */
+	size_t weight;
+	/** The entries, in no particular order. */
+	std::vector<Entry> entries;
+	/** Maps the keys to their entries. */
+	HashIndex index;
+	/** Most recently used entry. */
+	uint32_t head;
+	/** Least recently used entry. */
+	uint32_t tail;
+	/** Lookup and eviction counters. */
+	CacheStats stats;
+
+	uint32_t find(const K& key) const
+	{
+		return find(key, HashIndex::fold(hasher(key)));
+	}
+
+	uint32_t find(const K& key, uint32_t h) const
+	{
+		return index.find(h, [this, &key](uint32_t e) {
+			return entries[e].key == key;
+		});
+	}
+
+	/** @brief Links entry @p e in as the most recently used one. */
+	void link_front(uint32_t e)
+	{
+		entries[e].prev = npos;
+		entries[e].next = head;
+		if (head == npos) {
+			tail = e;
+		} else {
+			entries[head].prev = e;
+		}
+		head = e;
+	}
+
+	/** @brief Unlinks entry @p e from the recency list. */
+	void unlink(uint32_t e)
+	{
+		Entry& x = entries[e];
+		if (x.prev == npos) {
+			head = x.next;
+		} else {
+			entries[x.prev].next = x.next;
+		}
+		if (x.next == npos) {
+			tail = x.prev;
+		} else {
+			entries[x.next].prev = x.prev;
+		}
+	}
+
+	/** @brief Makes entry @p e the most recently used one. */
+	void touch(uint32_t e)
+	{
+		if (e != head) {
+			unlink(e);
+			link_front(e);
+		}
+	}
+
+	/**
+         * @brief Removes entry @p e and moves the last entry of the array
+         *        into its place, pointing its neighbours and its slot in
+         *        the index at the new position.
+         */
+	void remove(uint32_t e)
+	{
+		unlink(e);
+		index.erase(entries[e].hash, e);
+		weight -= entries[e].weight;
+		uint32_t last = uint32_t(entries.size() - 1);
+		if (e != last) {
+			Entry& x = entries[last];
+			if (x.prev == npos) {
+				head = e;
+			} else {
+				entries[x.prev].next = e;
+			}
+			if (x.next == npos) {
+				tail = e;
+			} else {
+				entries[x.next].prev = e;
+			}
+			index.relocate(x.hash, last, e);
+			entries[e] = std::move(x);
+		}
+		entries.pop_back();
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_LRU_CACHE_H
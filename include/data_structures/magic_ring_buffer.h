@@ -0,0 +1,384 @@
+#ifndef DATA_STRUCTURES_MAGIC_RING_BUFFER_H
+#define DATA_STRUCTURES_MAGIC_RING_BUFFER_H
+
+#include <cerrno>
+#include <cstring>
+#include <initializer_list>
+#include <stdexcept>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "span.h"
+
+namespace DataStructures {
+
+/**
+ * @class MagicRingBuffer
+ * @brief Ring buffer whose contents are always contiguous in memory.
+ *
+ * The storage is a @c memfd mapped twice, back to back, in one reserved
+ * address range. Element @c i and element @c i + capacity therefore alias the
+ * same physical memory, so any window of up to capacity elements starting
+ * anywhere in the first mapping can be read or written through one pointer,
+ * including windows that wrap around the end of the buffer.
+ *
+ * This lets producers and consumers work on the buffer in place through
+ * @ref write_span() / @ref commit_write() and @ref read_span() /
+ * @ref commit_read(), and makes scatter/gather I/O unnecessary: what would
+ * be a two element @c iovec for a @ref CircularArray is a single
+ * @c read(2) / @c write(2) here, see @ref read_from() and @ref write_to().
+ *
+ * Linux only. The capacity is rounded up so that the mapping size is a
+ * multiple of the page size.
+ *
+ * @tparam T Type of the elements, which must be trivially copyable.
+ */
+template <typename T = unsigned char>
+class MagicRingBuffer {
+	static_assert(std::is_trivially_copyable<T>::value,
+		      "MagicRingBuffer requires a trivially copyable type");
+
+public:
+	/**
+         * @brief Constructor for the MagicRingBuffer class.
+         *
+         * Creates the backing @c memfd, reserves twice its size of address
+         * space and maps the file into both halves.
+         *
+         * @param min_capacity Minimum number of elements the buffer must hold.
+         * @throws std::system_error if creating or mapping the memory fails.
+         */
+	explicit MagicRingBuffer(size_t min_capacity)
+		: base(nullptr), bytes(0), cap(0), head(0), count(0)
+	{
+		size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+		size_t unit = page / gcd(page, sizeof(T)) * sizeof(T);
+		size_t wanted = (min_capacity > 0 ? min_capacity : 1) *
+				sizeof(T);
+		bytes = (wanted + unit - 1) / unit * unit;
+		cap = bytes / sizeof(T);
+		map();
+	}
+
+	/**
+         * @brief Destructor for the MagicRingBuffer class.
+         *
+         * Unmaps both views of the buffer, which also releases the
+         * @c memfd.
+         */
+	~MagicRingBuffer() { unmap(); }
+
+	MagicRingBuffer(const MagicRingBuffer&) = delete;
+	MagicRingBuffer& operator=(const MagicRingBuffer&) = delete;
+
+	/**
+         * @brief Move constructor, takes over the mapping of @p other.
+         * @param other The buffer to move from, left without storage.
+         */
+	MagicRingBuffer(MagicRingBuffer&& other) noexcept
+		: base(other.base)
+		, bytes(other.bytes)
+		, cap(other.cap)
+		, head(other.head)
+		, count(other.count)
+	{
+		other.release();
+	}
+
+	/**
+         * @brief Move assignment, takes over the mapping of @p other.
+         * @param other The buffer to move from, left without storage.
+         * @return Reference to this buffer.
+         */
+	MagicRingBuffer& operator=(MagicRingBuffer&& other) noexcept
+	{
+		if (this != &other) {
+			unmap();
+			base = other.base;
+			bytes = other.bytes;
+			cap = other.cap;
+			head = other.head;
+			count = other.count;
+			other.release();
+		}
+		return *this;
+	}
+
+	/* Zero-copy functions */
+	/**
+         * @brief Get the free space of the buffer as one contiguous span.
+         *
+         * Elements written into the span become readable only after
+         * @ref commit_write().
+         *
+         * @return Span over all currently free slots, in write order.
+         */
+	Span<T> write_span()
+	{
+		return Span<T>(data() + write_offset(), cap - count);
+	}
+
+	/**
+         * @brief Publish elements written into the @ref write_span().
+         * @param n Number of elements to publish.
+         * @throws std::out_of_range if @p n exceeds the free space.
+         */
+	void commit_write(size_t n)
+	{
+		if (n > cap - count) {
+			throw std::out_of_range("Commit exceeds free space");
+		}
+		count += n;
+	}
+
+	/**
+         * @brief Get the readable contents of the buffer as one contiguous
+         *        span.
+         * @return Span over all currently stored elements, oldest first.
+         */
+	Span<const T> read_span() const
+	{
+		return Span<const T>(data() + head, count);
+	}
+
+	/**
+         * @brief Consume elements from the front of the @ref read_span().
+         * @param n Number of elements to consume.
+         * @throws std::out_of_range if @p n exceeds the stored elements.
+         */
+	void commit_read(size_t n)
+	{
+		if (n > count) {
+			throw std::out_of_range(
+				"Commit exceeds stored elements");
+		}
+		head += n;
+		if (head >= cap) {
+			head -= cap;
+		}
+		count -= n;
+	}
+
+	/* Copy functions */
+	/**
+         * @brief Copy elements to the back of the buffer.
+         * @param src Elements to copy.
+         * @param n Number of elements available at @p src.
+         * @return Number of elements copied, limited by the free space.
+         */
+	size_t write(const T* src, size_t n)
+	{
+		Span<T> span = write_span();
+		size_t todo = n < span.size() ? n : span.size();
+		if (todo > 0) {
+			std::memcpy(span.data(), src, todo * sizeof(T));
+		}
+		count += todo;
+		return todo;
+	}
+
+	/**
+         * @brief Copy elements out of the front of the buffer and consume
+         *        them.
+         * @param dst Destination for the elements.
+         * @param n Maximum number of elements to copy.
+         * @return Number of elements copied, limited by the stored elements.
+         */
+	size_t read(T* dst, size_t n)
+	{
+		Span<const T> span = read_span();
+		size_t todo = n < span.size() ? n : span.size();
+		if (todo > 0) {
+			std::memcpy(dst, span.data(), todo * sizeof(T));
+		}
+		commit_read(todo);
+		return todo;
+	}
+
+	/* I/O functions */
+	/**
+         * @brief Fill the free space of the buffer from a file descriptor
+         *        with a single @c read(2).
+         *
+         * Only whole elements are committed, so this is meant for byte
+         * buffers or for descriptors that deliver whole records.
+         *
+         * @param fd The file descriptor to read from.
+         * @return Number of bytes read, 0 at end of file or when the buffer is
+         *         full, -1 on error with @c errno set.
+         */
+	ssize_t read_from(int fd)
+	{
+		Span<T> span = write_span();
+		if (span.empty()) {
+			return 0;
+		}
+		ssize_t got = ::read(fd, span.data(), span.size() * sizeof(T));
+		if (got > 0) {
+			count += static_cast<size_t>(got) / sizeof(T);
+		}
+		return got;
+	}
+
+	/**
+         * @brief Drain the buffer to a file descriptor with a single
+         *        @c write(2).
+         *
+         * Only whole elements are consumed, so this is meant for byte buffers
+         * or for descriptors that accept whole records.
+         *
+         * @param fd The file descriptor to write to.
+         * @return Number of bytes written, -1 on error with @c errno set.
+         */
+	ssize_t write_to(int fd)
+	{
+		Span<const T> span = read_span();
+		if (span.empty()) {
+			return 0;
+		}
+		ssize_t put =
+			::write(fd, span.data(), span.size() * sizeof(T));
+		if (put > 0) {
+			commit_read(static_cast<size_t>(put) / sizeof(T));
+		}
+		return put;
+	}
+
+	/* Utility functions */
+	/**
+         * @brief Exchanges the mappings of two buffers in O(1).
+         * @param other The buffer to swap with.
+         */
+	void swap(MagicRingBuffer& other) noexcept
+	{
+		std::swap(base, other.base);
+		std::swap(bytes, other.bytes);
+		std::swap(cap, other.cap);
+		std::swap(head, other.head);
+		std::swap(count, other.count);
+	}
+
+	/**
+         * @brief Get the number of elements stored in the buffer.
+         * @return Number of stored elements.
+         */
+	size_t get_size() const { return count; }
+
+	/**
+         * @brief Get the maximum number of elements the buffer can hold.
+         * @return Capacity of the buffer after page rounding.
+         */
+	size_t get_capacity() const { return cap; }
+
+	/**
+         * @brief Check if the buffer is empty.
+         * @return true if the buffer has no elements, false otherwise.
+         */
+	bool is_empty() const { return count == 0; }
+
+	/**
+         * @brief Check if the buffer is full.
+         * @return true if no more elements can be written, false otherwise.
+         */
+	bool is_full() const { return count == cap; }
+
+private:
+	/** Start of the reserved range, holding two views of the memfd. */
+	void* base;
+	/** Size in bytes of one view. */
+	size_t bytes;
+	/** Capacity in elements. */
+	size_t cap;
+	/** Offset of the oldest element, always in [0, cap). */
+	size_t head;
+	/** Number of stored elements. */
+	size_t count;
+
+	T* data() const { return static_cast<T*>(base); }
+
+	size_t write_offset() const
+	{
+		size_t off = head + count;
+		return off < cap ? off : off - cap;
+	}
+
+	static size_t gcd(size_t a, size_t b)
+	{
+		while (b != 0) {
+			size_t r = a % b;
+			a = b;
+			b = r;
+		}
+		return a;
+	}
+
+	/**
+         * @brief Create the memfd and map it twice into a reserved range.
+         * @throws std::system_error naming the failing call.
+         */
+	void map()
+	{
+		int fd = memfd_create("magic_ring_buffer", MFD_CLOEXEC);
+		if (fd == -1) {
+			fail("memfd_create", -1);
+		}
+		if (ftruncate(fd, static_cast<off_t>(bytes)) == -1) {
+			fail("ftruncate", fd);
+		}
+		base = mmap(nullptr, 2 * bytes, PROT_NONE,
+			    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (base == MAP_FAILED) {
+			base = nullptr;
+			fail("mmap", fd);
+		}
+		char* lower = static_cast<char*>(base);
+		for (char* view : {lower, lower + bytes}) {
+			void* p = mmap(view, bytes, PROT_READ | PROT_WRITE,
+				       MAP_SHARED | MAP_FIXED, fd, 0);
+			if (p == MAP_FAILED) {
+				fail("mmap", fd);
+			}
+		}
+		close(fd);
+	}
+
+	/**
+         * @brief Release everything acquired so far and report the error.
+         * @param what Name of the failing call.
+         * @param fd The memfd to close, or -1.
+         */
+	[[noreturn]] void fail(const char* what, int fd)
+	{
+		int err = errno;
+		if (fd != -1) {
+			close(fd);
+		}
+		unmap();
+		throw std::system_error(err, std::generic_category(), what);
+	}
+
+	void unmap()
+	{
+		if (base != nullptr) {
+			munmap(base, 2 * bytes);
+		}
+		release();
+	}
+
+	void release()
+	{
+		base = nullptr;
+		bytes = 0;
+		cap = 0;
+		head = 0;
+		count = 0;
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_MAGIC_RING_BUFFER_H
@@ -0,0 +1,350 @@
+#ifndef DATA_STRUCTURES_NODE_POOL_H
+#define DATA_STRUCTURES_NODE_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace DataStructures {
+
+/**
+ * @class SlabPool
+ * @brief Fixed-size block allocator carving blocks out of large slabs.
+ *
+ * Slabs are allocated with a growing number of blocks, starting small so
+ * that short lists stay small, and are aligned to a cache line. Blocks are
+ * handed out from the newest slab in address order, so nodes allocated one
+ * after another end up next to each other in memory. Freed blocks go onto
+ * an intrusive free list threaded through the blocks themselves and are
+ * reused first.
+ *
+ * Memory only goes back to the system as whole slabs, either through
+ * @ref release() once no block is in use anymore, or when the pool is
+ * destroyed. Two pools with the same block size can be merged in O(1),
+ * which lets containers move nodes between each other by relinking them.
+ * The pool is not thread-safe.
+ */
+class SlabPool {
+public:
+	/**
+         * @brief Constructor for the SlabPool class.
+         *
+         * No memory is allocated until the first block is requested.
+         *
+         * @param block_size Size of every block in bytes.
+         * @param block_align Alignment of every block, a power of two.
+         */
+	SlabPool(size_t block_size, size_t block_align)
+		: align(block_align > alignof(FreeBlock) ? block_align
+							 : alignof(FreeBlock))
+		, size(round_up(block_size > sizeof(FreeBlock)
+					? block_size
+					: sizeof(FreeBlock),
+				align))
+		, slabs(nullptr)
+		, last_slab(nullptr)
+		, free_list(nullptr)
+		, last_free(nullptr)
+		, bump(nullptr)
+		, bump_end(nullptr)
+		, next_blocks(min_blocks)
+		, in_use(0)
+		, reserved(0)
+		, slab_count(0)
+	{
+	}
+
+	/**
+         * @brief Destructor for the SlabPool class.
+         *
+         * Frees every slab, whether or not its blocks are still in use.
+         */
+	~SlabPool() { release(); }
+
+	SlabPool(const SlabPool&) = delete;
+	SlabPool& operator=(const SlabPool&) = delete;
+
+	/**
+         * @brief Gets a block, reusing a freed one if there is any.
+         * @return Pointer to an uninitialized block.
+         */
+	void* allocate()
+	{
+		if (free_list != nullptr) {
+			FreeBlock* b = free_list;
+			free_list = b->next;
+			in_use++;
+			return b;
+		}
+		if (bump == bump_end) {
+			grow(next_blocks);
+		}
+		void* p = bump;
+		bump += size;
+		in_use++;
+		return p;
+	}
+
+	/**
+         * @brief Returns a block to the pool for reuse.
+         * @param p A block obtained from this pool, no longer in use.
+         */
+	void deallocate(void* p)
+	{
+		FreeBlock* b = static_cast<FreeBlock*>(p);
+		if (free_list == nullptr) {
+			last_free = b;
+		}
+		b->next = free_list;
+		free_list = b;
+		in_use--;
+	}
+
+	/**
+         * @brief Makes sure that the next @p n blocks handed out that are
+         *        not reused from the free list come from one slab, in
+         *        address order.
+         *
+         * If the unused rest of the newest slab is too small, a slab of at
+         * least @p n blocks is allocated, abandoning that rest. Allocating
+         * those blocks afterwards cannot fail.
+         *
+         * @param n The number of blocks.
+         */
+	void reserve(size_t n)
+	{
+		if (size_t(bump_end - bump) / size < n) {
+			grow(n > next_blocks ? n : next_blocks);
+		}
+	}
+
+	/**
+         * @brief Takes over every slab of another pool in O(1).
+         *
+         * Blocks handed out by @p other stay valid and may from now on be
+         * given back to this pool, while @p other is left empty. Only the
+         * larger of the two unused rests of the newest slabs is kept for
+         * handing out, the other one stays unused until the slabs are
+         * freed.
+         *
+         * @param other A pool with the same block size and alignment.
+         * @throws std::invalid_argument if the block sizes differ.
+         */
+	void merge(SlabPool& other)
+	{
+		if (&other == this || other.slabs == nullptr) {
+			return;
+		}
+		if (other.size != size || other.align != align) {
+			throw std::invalid_argument("Block sizes differ");
+		}
+		other.last_slab->next = slabs;
+		if (slabs == nullptr) {
+			last_slab = other.last_slab;
+		}
+		slabs = other.slabs;
+		if (other.free_list != nullptr) {
+			other.last_free->next = free_list;
+			if (free_list == nullptr) {
+				last_free = other.last_free;
+			}
+			free_list = other.free_list;
+		}
+		if (other.bump_end - other.bump > bump_end - bump) {
+			bump = other.bump;
+			bump_end = other.bump_end;
+		}
+		if (other.next_blocks > next_blocks) {
+			next_blocks = other.next_blocks;
+		}
+		in_use += other.in_use;
+		reserved += other.reserved;
+		slab_count += other.slab_count;
+		other.forget();
+	}
+
+	/**
+         * @brief Frees every slab at once.
+         *
+         * Any block still handed out becomes invalid, so this is only meant
+         * for when every block has been given back or its contents need no
+         * cleanup. The pool starts over with small slabs afterwards.
+         */
+	void release()
+	{
+		while (slabs != nullptr) {
+			SlabHeader* next = slabs->next;
+			::operator delete(slabs->raw);
+			slabs = next;
+		}
+		forget();
+	}
+
+	/**
+         * @brief Gets the size of every block.
+         * @return The block size in bytes, after rounding up.
+         */
+	size_t block_size() const { return size; }
+
+	/**
+         * @brief Gets the number of blocks currently handed out.
+         * @return The number of blocks in use.
+         */
+	size_t blocks_in_use() const { return in_use; }
+
+	/**
+         * @brief Gets the number of blocks in all slabs.
+         * @return The number of blocks the pool holds memory for.
+         */
+	size_t blocks_reserved() const { return reserved; }
+
+	/**
+         * @brief Gets the number of slabs allocated from the system.
+         * @return The number of slabs.
+         */
+	size_t slabs_allocated() const { return slab_count; }
+
+private:
+	/** Alignment of every slab, one cache line. */
+	static const size_t slab_align = 64;
+	/** Number of blocks in the first slab. */
+	static const size_t min_blocks = 16;
+	/** Number of blocks after which slabs stop growing. */
+	static const size_t max_blocks = 4096;
+
+	/** @brief Link of a block on the free list. */
+	struct FreeBlock {
+		FreeBlock* next;
+	};
+
+	/** @brief Bookkeeping at the start of every slab. */
+	struct SlabHeader {
+		SlabHeader* next;
+		void* raw;
+	};
+
+	/** Alignment of every block. */
+	const size_t align;
+	/** Size of every block, a multiple of @ref align. */
+	const size_t size;
+	/** Most recently allocated slab. */
+	SlabHeader* slabs;
+	/** Oldest slab, the end of the slab list. */
+	SlabHeader* last_slab;
+	/** Blocks given back and not reused yet. */
+	FreeBlock* free_list;
+	/** End of the free list, valid while the list is not empty. */
+	FreeBlock* last_free;
+	/** Next never used block of the newest slab. */
+	unsigned char* bump;
+	/** End of the newest slab. */
+	unsigned char* bump_end;
+	/** Number of blocks in the next slab. */
+	size_t next_blocks;
+	/** Number of blocks handed out. */
+	size_t in_use;
+	/** Number of blocks in all slabs. */
+	size_t reserved;
+	/** Number of slabs. */
+	size_t slab_count;
+
+	static size_t round_up(size_t n, size_t a)
+	{
+		return (n + a - 1) / a * a;
+	}
+
+	/** @brief Drops every slab without freeing it, emptying the pool. */
+	void forget()
+	{
+		slabs = nullptr;
+		last_slab = nullptr;
+		free_list = nullptr;
+		last_free = nullptr;
+		bump = nullptr;
+		bump_end = nullptr;
+		next_blocks = min_blocks;
+		in_use = 0;
+		reserved = 0;
+		slab_count = 0;
+	}
+
+	/**
+         * @brief Allocates a new slab of @p blocks blocks and doubles the
+         *        size of the next one.
+         */
+	void grow(size_t blocks)
+	{
+		size_t a = align > slab_align ? align : slab_align;
+		size_t first = round_up(sizeof(SlabHeader), align);
+		size_t bytes = first + blocks * size;
+		void* raw = ::operator new(bytes + a - 1);
+		uintptr_t base =
+			round_up(reinterpret_cast<uintptr_t>(raw), a);
+		SlabHeader* h = reinterpret_cast<SlabHeader*>(base);
+		h->next = slabs;
+		h->raw = raw;
+		if (slabs == nullptr) {
+			last_slab = h;
+		}
+		slabs = h;
+		bump = reinterpret_cast<unsigned char*>(base) + first;
+		bump_end = bump + blocks * size;
+		reserved += blocks;
+		slab_count++;
+		if (next_blocks < max_blocks) {
+			next_blocks *= 2;
+		}
+	}
+};
+
+/**
+ * @class NodePool
+ * @brief Typed @ref SlabPool constructing and destroying objects in place.
+ *
+ * Used by the linked lists for their nodes. A pool may be shared between
+ * several lists of the same type, so that nodes freed by one are reused by
+ * the others.
+ *
+ * @tparam T Type of the pooled objects.
+ */
+template <typename T>
+class NodePool : public SlabPool {
+public:
+	/**
+         * @brief Constructor for an empty NodePool.
+         */
+	NodePool() : SlabPool(sizeof(T), alignof(T)) {}
+
+	/**
+         * @brief Constructs an object in a block of the pool.
+         * @param args Arguments forwarded to the constructor of @p T.
+         * @return Pointer to the new object.
+         */
+	template <typename... Args>
+	T* create(Args&&... args)
+	{
+		void* p = allocate();
+		try {
+			return new (p) T(std::forward<Args>(args)...);
+		} catch (...) {
+			deallocate(p);
+			throw;
+		}
+	}
+
+	/**
+         * @brief Destroys an object and gives its block back to the pool.
+         * @param p An object obtained from @ref create().
+         */
+	void destroy(T* p)
+	{
+		p->~T();
+		deallocate(p);
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_NODE_POOL_H
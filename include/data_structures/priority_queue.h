@@ -0,0 +1,260 @@
+#ifndef DATA_STRUCTURES_PRIORITY_QUEUE_H
+#define DATA_STRUCTURES_PRIORITY_QUEUE_H
+
+#include <functional>
+#include <stdexcept>
+#include <utility>
+
+#include "dynamic_array.h"
+
+namespace DataStructures {
+
+/**
+ * @class PriorityQueue
+ * @brief Implicit d-ary heap priority queue with all related functionality.
+ *
+ * The heap is stored level by level in a @ref DynamicArray, the children of
+ * the element at index @c i being at indices @c Arity*i+1 to @c Arity*i+Arity.
+ * Wider heaps are shallower, so sifting down touches fewer levels, and the
+ * children of one element sit next to each other in memory.
+ *
+ * Sift operations move a hole instead of swapping: the element being placed
+ * is held aside while the elements on its path are shifted one level, and it
+ * is written once at its final position.
+ *
+ * As with @c std::priority_queue, the element at the top is the greatest one
+ * according to @p Compare, so @c std::greater gives a min-heap.
+ *
+ * @tparam T Type of the implementation class.
+ * @tparam Compare Strict weak ordering of the elements.
+ * @tparam Arity Number of children of each element, at least two.
+ */
+template <typename T, typename Compare = std::less<T>, size_t Arity = 2>
+class PriorityQueue {
+	static_assert(Arity >= 2, "A heap needs at least two children per node");
+
+public:
+	/**
+         * @brief Constructor for an empty PriorityQueue.
+         * @param compare The ordering of the elements.
+         */
+	explicit PriorityQueue(const Compare& compare = Compare())
+		: comp(compare)
+	{
+	}
+
+	/**
+         * @brief Constructs a PriorityQueue from a range of elements.
+         *
+         * The elements are appended in their given order and then turned into
+         * a heap bottom-up, sifting down every internal element from the last
+         * one to the root, which takes O(n) time instead of the O(n log n) of
+         * pushing them one at a time.
+         *
+         * @param first Iterator to the first element.
+         * @param last Iterator past the last element.
+         * @param compare The ordering of the elements.
+         */
+	template <typename InputIt>
+	PriorityQueue(InputIt first, InputIt last,
+		      const Compare& compare = Compare())
+		: comp(compare)
+	{
+		for (; first != last; ++first) {
+			heap.add_last(*first);
+		}
+		heapify();
+	}
+
+	/**
+         * @brief Pushes an element into the queue.
+         * @param element The element to be pushed.
+         */
+	void push(const T& element)
+	{
+		heap.add_last(element);
+		sift_up(heap.get_size() - 1);
+	}
+
+	/**
+         * @brief Pops the top element of the queue and returns its value.
+         *
+         * The last element of the heap is taken out and sifted down from the
+         * root into the hole left by the top element.
+         *
+         * @return The value of the popped element.
+         * @throws std::out_of_range stating that the "Priority queue is
+         *         empty".
+         */
+	T pop()
+	{
+		check_not_empty();
+		T top = std::move(heap[0]);
+		T last = heap.del_last();
+		if (!heap.is_empty()) {
+			sift_down(0, std::move(last));
+		}
+		return top;
+	}
+
+	/**
+         * @brief Gets the value of the top element of the queue.
+         * @return The value of the top element.
+         * @throws std::out_of_range stating that the "Priority queue is
+         *         empty".
+         */
+	T peek() const
+	{
+		check_not_empty();
+		return heap[0];
+	}
+
+	/**
+         * @brief Pushes an element and then pops the top element in a single
+         *        sift.
+         *
+         * If the new element would itself be the top, it is returned right
+         * away without touching the heap. Otherwise it replaces the top
+         * element and is sifted down.
+         *
+         * @param element The element to be pushed.
+         * @return The value of the popped element.
+         */
+	T push_pop(const T& element)
+	{
+		if (heap.is_empty() || !comp(element, heap[0])) {
+			return element;
+		}
+		T top = std::move(heap[0]);
+		sift_down(0, element);
+		return top;
+	}
+
+	/**
+         * @brief Pops the top element and then pushes an element in a single
+         *        sift.
+         *
+         * Unlike @ref push_pop() the top element is always removed, even if
+         * the new element is greater.
+         *
+         * @param element The element to be pushed.
+         * @return The value of the popped element.
+         * @throws std::out_of_range stating that the "Priority queue is
+         *         empty".
+         */
+	T replace_top(const T& element)
+	{
+		check_not_empty();
+		T top = std::move(heap[0]);
+		sift_down(0, element);
+		return top;
+	}
+
+	/**
+         * @brief Gets the current size of the queue.
+         * @return The current size of the queue.
+         */
+	size_t size() const { return heap.get_size(); }
+
+	/**
+         * @brief Check if the queue is empty.
+         * @return true if the queue has no elements, false otherwise.
+         */
+	bool is_empty() const { return heap.is_empty(); }
+
+	/**
+         * @brief Exchanges the contents and orderings of two queues in O(1).
+         * @param other The queue to swap with.
+         */
+	void swap(PriorityQueue& other)
+	{
+		heap.swap(other.heap);
+		std::swap(comp, other.comp);
+	}
+
+private:
+	/** The dynamic array holding the heap in level order. */
+	DynamicArray<T> heap;
+	/** The ordering of the elements. */
+	Compare comp;
+
+	/**
+         * @brief Moves the element at @p hole up until its parent is not
+         *        less than it.
+         * @param hole Index of the element to be sifted up.
+         */
+	void sift_up(size_t hole)
+	{
+		T val = std::move(heap[hole]);
+		while (hole > 0) {
+			size_t parent = (hole - 1) / Arity;
+			if (!comp(heap[parent], val)) {
+				break;
+			}
+			heap[hole] = std::move(heap[parent]);
+			hole = parent;
+		}
+		heap[hole] = std::move(val);
+	}
+
+	/**
+         * @brief Places @p val into the subtree rooted at @p hole, moving the
+         *        greatest child up as long as it is greater than @p val.
+         * @param hole Index of the empty slot.
+         * @param val The element to be placed.
+         */
+	void sift_down(size_t hole, T val)
+	{
+		size_t n = heap.get_size();
+		for (;;) {
+			size_t first = hole * Arity + 1;
+			if (first >= n) {
+				break;
+			}
+			size_t last = first + Arity < n ? first + Arity : n;
+			size_t best = first;
+			for (size_t c = first + 1; c < last; c++) {
+				if (comp(heap[best], heap[c])) {
+					best = c;
+				}
+			}
+			if (!comp(val, heap[best])) {
+				break;
+			}
+			heap[hole] = std::move(heap[best]);
+			hole = best;
+		}
+		heap[hole] = std::move(val);
+	}
+
+	/**
+         * @brief Turns the array into a heap by sifting down every internal
+         *        element, starting from the last one.
+         */
+	void heapify()
+	{
+		size_t n = heap.get_size();
+		if (n < 2) {
+			return;
+		}
+		for (size_t i = (n - 2) / Arity + 1; i-- > 0;) {
+			sift_down(i, std::move(heap[i]));
+		}
+	}
+
+	/**
+         * @brief Throws if the queue is empty.
+         * @throws std::out_of_range stating that the "Priority queue is
+         *         empty".
+         */
+	void check_not_empty() const
+	{
+		if (heap.is_empty()) {
+			throw std::out_of_range("Priority queue is empty");
+		}
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_PRIORITY_QUEUE_H
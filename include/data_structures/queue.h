@@ -0,0 +1,122 @@
+#ifndef DATA_STRUCTURES_QUEUE_H
+#define DATA_STRUCTURES_QUEUE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "backend_traits.h"
+#include "circular_array.h"
+
+namespace DataStructures {
+
+/**
+ * @class Queue
+ * @brief Queue adapter over any container described by @ref BackendTraits.
+ *
+ * Elements are added at the end of the container and removed from its
+ * front, so the backend must do both in O(1), which is checked at compile
+ * time. Popping checks for an empty queue once and then deletes with the
+ * single removing operation of the backend.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Container The backend container.
+ */
+template <typename T, typename Container = CircularArray<T>>
+class Queue {
+	typedef BackendTraits<Container> Traits;
+
+	static_assert(std::is_same<typename Traits::value_type, T>::value,
+		      "Queue backend must hold elements of type T");
+	static_assert(Traits::fast_add_last && Traits::fast_del_first,
+		      "Queue backend must add at its end and delete at its "
+		      "front in O(1)");
+
+public:
+	/**
+         * @brief Push the element at the back of the queue.
+         * @param element The element to be pushed.
+         */
+	void push(const T& element) { Traits::add_last(c, element); }
+
+	/**
+         * @brief Pop the element from the front of the queue and return its
+         *        value.
+         * @return The value of the element that has been popped.
+         * @throws std::out_of_range if the queue is empty.
+         */
+	T pop()
+	{
+		if (Traits::empty(c)) {
+			throw std::out_of_range("Queue is empty");
+		}
+		return Traits::del_first(c);
+	}
+
+	/**
+         * @brief Get the value of the element at the front of the queue.
+         * @return The value of the element at the front of the queue.
+         * @throws std::out_of_range if the queue is empty.
+         */
+	T peek() const
+	{
+		if (Traits::empty(c)) {
+			throw std::out_of_range("Queue is empty");
+		}
+		return Traits::get_first(c);
+	}
+
+	/**
+         * @brief Get the current size of the queue.
+         * @return The current size of the queue.
+         */
+	size_t size() const { return Traits::size(c); }
+
+	/**
+         * @brief Check if the queue is empty.
+         * @return true if the queue has no elements, false otherwise.
+         */
+	bool is_empty() const { return Traits::empty(c); }
+
+	/**
+         * @brief Pop the front element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (Traits::empty(c)) {
+			return false;
+		}
+		out = Traits::del_first(c);
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (Traits::empty(c)) {
+			return false;
+		}
+		out = Traits::get_first(c);
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two queues in O(1).
+         * @param other The queue to swap with.
+         */
+	void swap(Queue& other) noexcept { c.swap(other.c); }
+
+private:
+	/**
+         * The container used to internally implement the queue.
+         */
+	Container c;
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_QUEUE_H
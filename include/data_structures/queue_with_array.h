@@ -13,11 +13,6 @@ namespace DataStructures {
 template <typename T>
 class QueueWithArray {
 public:
-	/**
-         * @brief Default constructor for the QueueWithArray class to intialize
-         *        the internal deque to an empty deque.
-         */
-	QueueWithArray() { arr = CircularArray<T>(); }
 	/**
          * @brief Pushes the element at the back of the queue.
          * @param element The element to be pushed.
@@ -43,6 +38,38 @@ public:
          */
 	size_t size() const { return arr.get_size(); }
 
+	/**
+         * @brief Pop the front element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (arr.is_empty()) {
+			return false;
+		}
+		out = arr.del_first();
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (arr.is_empty()) {
+			return false;
+		}
+		out = arr.get_first();
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two queues in O(1).
+         * @param other The queue to swap with.
+         */
+	void swap(QueueWithArray& other) noexcept { arr.swap(other.arr); }
+
 private:
 	/** The circular array used to internally implement the queue. */
 	CircularArray<T> arr;
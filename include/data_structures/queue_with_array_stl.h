@@ -2,6 +2,7 @@
 #define DATA_STRUCTURES_QUEUE_WITH_ARRAY_STL_H
 
 #include <deque>
+#include <utility>
 
 namespace DataStructures {
 
@@ -13,11 +14,6 @@ namespace DataStructures {
 template <typename T>
 class QueueWithArraySTL {
 public:
-	/**
-         * @brief Default constructor for the QueueWithArray class to intialize
-         *        the internal deque to an empty deque.
-         */
-	QueueWithArraySTL() { arr = std::deque<T>(); }
 	/**
          * @brief Pushes the element at the back of the queue.
          * @param element The element to be pushed.
@@ -59,6 +55,39 @@ public:
          */
 	size_t size() const { return arr.size(); }
 
+	/**
+         * @brief Pop the front element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (arr.empty()) {
+			return false;
+		}
+		out = std::move(arr.front());
+		arr.pop_front();
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (arr.empty()) {
+			return false;
+		}
+		out = arr.front();
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two queues in O(1).
+         * @param other The queue to swap with.
+         */
+	void swap(QueueWithArraySTL& other) noexcept { arr.swap(other.arr); }
+
 private:
 	/** The deque used to internally implement the queue. */
 	std::deque<T> arr;
@@ -43,6 +43,41 @@ public:
          */
 	size_t size() const { return list.get_size(); }
 
+	/**
+         * @brief Pop the front element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (list.is_empty()) {
+			return false;
+		}
+		out = list.del_first();
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (list.is_empty()) {
+			return false;
+		}
+		out = list.get_first();
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two queues in O(1).
+         * @param other The queue to swap with.
+         */
+	void swap(QueueWithLinkedList& other) noexcept
+	{
+		list.swap(other.list);
+	}
+
 private:
 	/**
          * The doubly linked list used for internally implementing the queue.
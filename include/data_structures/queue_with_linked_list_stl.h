@@ -2,6 +2,7 @@
 #define DATA_STRUCTURES_QUEUE_WITH_LINKED_LIST_STL_H
 
 #include <list>
+#include <utility>
 
 namespace DataStructures {
 
@@ -54,6 +55,42 @@ public:
          */
 	size_t size() const { return list.size(); }
 
+	/**
+         * @brief Pop the front element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (list.empty()) {
+			return false;
+		}
+		out = std::move(list.front());
+		list.pop_front();
+		return true;
+	}
+
+	/**
+         * @brief Get the first element into @p out if there is one.
+         * @return false if the queue was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (list.empty()) {
+			return false;
+		}
+		out = list.front();
+		return true;
+	}
+
+	/**
+         * @brief Exchanges the contents of two queues in O(1).
+         * @param other The queue to swap with.
+         */
+	void swap(QueueWithLinkedListSTL& other) noexcept
+	{
+		list.swap(other.list);
+	}
+
 private:
 	/**
          * The doubly linked list used for internally implementing the queue.
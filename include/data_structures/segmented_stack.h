@@ -0,0 +1,295 @@
+#ifndef DATA_STRUCTURES_SEGMENTED_STACK_H
+#define DATA_STRUCTURES_SEGMENTED_STACK_H
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+ * @class SegmentedStack
+ * @brief Stack of fixed-size array chunks linked from the top down, which
+ *        grows without ever copying or moving its elements.
+ *
+ * A full top chunk is followed by a new one instead of being reallocated,
+ * so every push takes O(1) time in the worst case rather than amortized,
+ * memory grows by one chunk at a time instead of briefly doubling, and
+ * references to the elements stay valid until they are popped.
+ *
+ * Popping the last element of a chunk keeps that chunk as a spare, which
+ * the next push crossing the boundary takes back instead of allocating,
+ * so a stack moving back and forth across a chunk boundary does not
+ * allocate at all. At most one spare is kept.
+ *
+ * @tparam T Type of the elements.
+ * @tparam ChunkSize Number of elements per chunk, by default as many as
+ *         fit into 4 KiB.
+ */
+template <typename T,
+	  size_t ChunkSize = (sizeof(T) < 4096 ? 4096 / sizeof(T) : 1)>
+class SegmentedStack {
+	static_assert(ChunkSize > 0,
+		      "SegmentedStack chunks must hold at least one element");
+
+public:
+	/**
+         * @brief Constructor for an empty SegmentedStack.
+         *
+         * No memory is allocated until the first push.
+         */
+	SegmentedStack() noexcept
+		: top_chunk(nullptr)
+		, spare(nullptr)
+		, top(ChunkSize)
+		, count(0)
+	{
+	}
+
+	/**
+         * @brief Copy constructor, copying every element from the bottom up.
+         * @param other The stack to copy.
+         */
+	SegmentedStack(const SegmentedStack& other) : SegmentedStack()
+	{
+		std::vector<const Chunk*> chunks;
+		for (const Chunk* c = other.top_chunk; c != nullptr;
+		     c = c->below) {
+			chunks.push_back(c);
+		}
+		for (size_t i = chunks.size(); i > 0; i--) {
+			size_t n = i == 1 ? other.top : ChunkSize;
+			for (size_t j = 0; j < n; j++) {
+				push(*chunks[i - 1]->slot(j));
+			}
+		}
+	}
+
+	/**
+         * @brief Move constructor, taking over the chunks of another stack
+         *        in O(1).
+         * @param other The stack to move from, left empty.
+         */
+	SegmentedStack(SegmentedStack&& other) noexcept : SegmentedStack()
+	{
+		swap(other);
+	}
+
+	/**
+         * @brief Assignment, replacing the elements by those of another
+         *        stack.
+         *
+         * Takes @p other by value, so it is copied or moved as appropriate
+         * and the old chunks are freed along with it.
+         *
+         * @param other The stack to take the elements from.
+         * @return Reference to this stack.
+         */
+	SegmentedStack& operator=(SegmentedStack other) noexcept
+	{
+		swap(other);
+		return *this;
+	}
+
+	/**
+         * @brief Destructor for the SegmentedStack class, destroying the
+         *        elements and freeing every chunk.
+         */
+	~SegmentedStack() { clear(); }
+
+	/**
+         * @brief Push the element at the top of the stack.
+         * @param element The element to be pushed.
+         */
+	void push(const T& element)
+	{
+		if (top == ChunkSize) {
+			push_onto_new_chunk(element);
+			return;
+		}
+		new (top_chunk->slot(top)) T(element);
+		top++;
+		count++;
+	}
+
+	/**
+         * @brief Pop the element from the top of the stack and return its
+         *        value.
+         * @return The value of the element that has been popped.
+         * @throws std::out_of_range if the stack is empty.
+         */
+	T pop()
+	{
+		if (count == 0) {
+			throw std::out_of_range("Stack is empty");
+		}
+		T* p = top_chunk->slot(top - 1);
+		T element(std::move(*p));
+		p->~T();
+		top--;
+		count--;
+		if (top == 0 && top_chunk->below != nullptr) {
+			drop_chunk();
+		}
+		return element;
+	}
+
+	/**
+         * @brief Get the value of the element at the top of the stack.
+         * @return The value of the element at the top of the stack.
+         * @throws std::out_of_range if the stack is empty.
+         */
+	T peek() const
+	{
+		if (count == 0) {
+			throw std::out_of_range("Stack is empty");
+		}
+		return *top_chunk->slot(top - 1);
+	}
+
+	/**
+         * @brief Pop the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (count == 0) {
+			return false;
+		}
+		out = pop();
+		return true;
+	}
+
+	/**
+         * @brief Get the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (count == 0) {
+			return false;
+		}
+		out = *top_chunk->slot(top - 1);
+		return true;
+	}
+
+	/**
+         * @brief Get the current size of the stack.
+         * @return The current size of the stack.
+         */
+	size_t size() const { return count; }
+
+	/**
+         * @brief Check if the stack is empty.
+         * @return true if the stack has no elements, false otherwise.
+         */
+	bool is_empty() const { return count == 0; }
+
+	/**
+         * @brief Get the number of elements per chunk.
+         * @return The chunk size.
+         */
+	static constexpr size_t chunk_size() { return ChunkSize; }
+
+	/**
+         * @brief Removes every element and frees every chunk, including
+         *        the spare one.
+         */
+	void clear()
+	{
+		while (top_chunk != nullptr) {
+			while (top > 0) {
+				top--;
+				top_chunk->slot(top)->~T();
+			}
+			Chunk* below = top_chunk->below;
+			delete top_chunk;
+			top_chunk = below;
+			top = ChunkSize;
+		}
+		delete spare;
+		spare = nullptr;
+		count = 0;
+	}
+
+	/**
+         * @brief Exchanges the contents of two stacks in O(1).
+         * @param other The stack to swap with.
+         */
+	void swap(SegmentedStack& other) noexcept
+	{
+		std::swap(top_chunk, other.top_chunk);
+		std::swap(spare, other.spare);
+		std::swap(top, other.top);
+		std::swap(count, other.count);
+	}
+
+private:
+	typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+	/** @brief Raw storage for @p ChunkSize elements. */
+	struct Chunk {
+		/** The next chunk towards the bottom of the stack. */
+		Chunk* below;
+		Slot slots[ChunkSize];
+
+		T* slot(size_t i) { return reinterpret_cast<T*>(&slots[i]); }
+
+		const T* slot(size_t i) const
+		{
+			return reinterpret_cast<const T*>(&slots[i]);
+		}
+	};
+
+	/** The chunk holding the top element, nullptr before the first push. */
+	Chunk* top_chunk;
+	/** An empty chunk kept for the next push crossing a boundary. */
+	Chunk* spare;
+	/** Number of elements in the top chunk, full while there is none. */
+	size_t top;
+	/** Number of elements. */
+	size_t count;
+
+	/**
+         * @brief Puts a chunk holding @p element on top, reusing the spare
+         *        chunk if there is one.
+         *
+         * The element is copied before the chunk is linked in, so if the
+         * copy throws the chunk becomes the spare and nothing else changes.
+         */
+	void push_onto_new_chunk(const T& element)
+	{
+		Chunk* c = spare;
+		if (c != nullptr) {
+			spare = nullptr;
+		} else {
+			c = new Chunk;
+		}
+		try {
+			new (c->slot(0)) T(element);
+		} catch (...) {
+			spare = c;
+			throw;
+		}
+		c->below = top_chunk;
+		top_chunk = c;
+		top = 1;
+		count++;
+	}
+
+	/** @brief Makes the empty top chunk the spare one. */
+	void drop_chunk()
+	{
+		delete spare;
+		spare = top_chunk;
+		top_chunk = top_chunk->below;
+		top = ChunkSize;
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_SEGMENTED_STACK_H
@@ -1,47 +1,95 @@
 #ifndef DATA_STRUCTURES_SINGLY_LINKED_LIST_H
 #define DATA_STRUCTURES_SINGLY_LINKED_LIST_H
 
+#include <cstddef>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "node_pool.h"
 
 namespace DataStructures {
 
 /**
  * @class SinglyLinkedList
  * @brief Singly linked list class with all related functionality.
+ *
+ * Nodes are allocated from a @ref NodePool, created along with the first
+ * node, which can also be shared with other lists of the same type.
+ *
  * @tparam T Type of the implementation class.
  */
 template <typename T>
 class SinglyLinkedList {
+	struct Node;
+
+	template <bool IsConst>
+	class Iterator;
+
 public:
+	class Cursor;
+
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+
+	/** @brief Type of the pool the nodes are allocated from. */
+	typedef NodePool<Node> Pool;
+
 	/**
          * @brief Constructor for the SinglyLinkedList class.
          *
-         * Initializes the head node and points the tail to the head. Size is
-         * initialized to zero.
+         * Points the tail to the head embedded in the list, so an empty list
+         * allocates nothing and @p T need not be default constructible. Size
+         * is initialized to zero.
          */
-	SinglyLinkedList()
+	SinglyLinkedList() noexcept : tail(&head), size(0) {}
+
+	/**
+         * @brief Constructor for a SinglyLinkedList allocating its nodes from
+         *        a given pool.
+         * @param node_pool The pool, possibly shared with other lists.
+         */
+	explicit SinglyLinkedList(std::shared_ptr<Pool> node_pool)
+		: SinglyLinkedList()
 	{
-		head = new Node(T());
-		tail = head;
-		size = 0;
+		pool = std::move(node_pool);
 	}
 
 	/**
-         * @brief Destructor for the SinglyLinkedList class.
-         *
-         * Clears the singly linked list and deletes the head and tail pointers.
+         * @brief Move constructor, taking over the nodes of another list in
+         *        O(1) and leaving it empty.
+         * @param other The list to move from.
          */
-	~SinglyLinkedList()
+	SinglyLinkedList(SinglyLinkedList&& other) noexcept : SinglyLinkedList()
 	{
-		Node* cur = head;
-		while (cur != nullptr) {
-			Node* next = cur->next;
-			delete cur;
-			cur = next;
-		}
+		swap(other);
 	}
 
+	/**
+         * @brief Move assignment, freeing the current nodes and taking over
+         *        those of another list in O(1).
+         * @param other The list to move from, left empty.
+         * @return Reference to this list.
+         */
+	SinglyLinkedList& operator=(SinglyLinkedList&& other) noexcept
+	{
+		SinglyLinkedList old(std::move(other));
+		swap(old);
+		return *this;
+	}
+
+	/**
+         * @brief Destructor for the SinglyLinkedList class.
+         *
+         * Frees every element node.
+         */
+	~SinglyLinkedList() { release_nodes(); }
+
 	/* Add functions */
 	/**
          * @brief Adds a new node at the start of the list.
@@ -54,9 +102,9 @@ public:
          */
 	void add_first(const T& data)
 	{
-		Node* x = new Node(data);
-		x->next = head->next;
-		head->next = x;
+		Node* x = new_node(data);
+		x->next = head.next;
+		head.next = x;
 		if (size == 0) {
 			tail = x;
 		}
@@ -74,7 +122,7 @@ public:
          */
 	void add_last(const T& data)
 	{
-		Node* x = new Node(data);
+		Node* x = new_node(data);
 		tail->next = x;
 		tail = x;
 		size++;
@@ -101,11 +149,11 @@ public:
 			add_last(data);
 			return;
 		}
-		Node* prev = head;
+		Link* prev = &head;
 		for (int i = 0; i < pos_index; i++) {
 			prev = prev->next;
 		}
-		Node* x = new Node(data);
+		Node* x = new_node(data);
 		x->next = prev->next;
 		prev->next = x;
 		size++;
@@ -130,14 +178,14 @@ public:
 		if (is_empty()) {
 			throw std::out_of_range("No nodes to remove");
 		}
-		Node* first = head->next;
-		head->next = first->next;
+		Node* first = head.next;
+		head.next = first->next;
 		if (size == 1) {
-			tail = head;
+			tail = &head;
 		}
 		size--;
 		T data = first->data;
-		delete first;
+		pool->destroy(first);
 		return data;
 	}
 
@@ -159,18 +207,45 @@ public:
 		if (is_empty()) {
 			throw std::out_of_range("No nodes to remove");
 		}
-		Node* prev = head;
+		Link* prev = &head;
 		while (prev->next != tail) {
 			prev = prev->next;
 		}
-		T data = tail->data;
-		delete tail;
+		Node* last = static_cast<Node*>(tail);
+		T data = last->data;
+		pool->destroy(last);
 		prev->next = nullptr;
 		tail = prev;
 		size--;
 		return data;
 	}
 
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_last();
+		return true;
+	}
+
 	/** 
          * @brief Delete a node at a particular index.
          *
@@ -186,7 +261,7 @@ public:
 	T del(int index)
 	{
 		check_element_index(index);
-		Node* prev = head;
+		Link* prev = &head;
 		for (int i = 0; i < index; i++) {
 			prev = prev->next;
 		}
@@ -197,7 +272,7 @@ public:
 		}
 		size--;
 		T data = x->data;
-		delete x;
+		pool->destroy(x);
 		return data;
 	}
 
@@ -217,7 +292,7 @@ public:
 		if (is_empty()) {
 			throw std::out_of_range("No nodes in the list");
 		}
-		return head->next->data;
+		return head.next->data;
 	}
 
 	/** 
@@ -235,7 +310,7 @@ public:
 		if (is_empty()) {
 			throw std::out_of_range("No nodes in the list");
 		}
-		return tail->data;
+		return static_cast<Node*>(tail)->data;
 	}
 
 	/**
@@ -271,7 +346,467 @@ public:
 		return x;
 	}
 
+	/* Bulk erase functions */
+	/**
+         * @brief Deletes every element satisfying a predicate.
+         *
+         * The list is traversed once, unlinking the matching nodes as they
+         * are found, so this takes O(n) time instead of the O(n^2) of
+         * calling @ref del() for every match. If @p pred throws, the
+         * elements matched so far stay deleted.
+         *
+         * @param pred Predicate called with every element.
+         * @return The number of deleted elements.
+         */
+	template <typename Predicate>
+	size_t erase_if(Predicate pred)
+	{
+		size_t removed = 0;
+		Link* prev = &head;
+		while (prev->next != nullptr) {
+			Node* x = prev->next;
+			if (pred(x->data)) {
+				prev->next = x->next;
+				if (tail == x) {
+					tail = prev;
+				}
+				pool->destroy(x);
+				size--;
+				removed++;
+			} else {
+				prev = x;
+			}
+		}
+		return removed;
+	}
+
+	/**
+         * @brief Deletes every element equal to a value.
+         * @param value The value to be removed.
+         * @return The number of deleted elements.
+         */
+	size_t remove(const T& value)
+	{
+		return erase_if([&value](const T& x) { return x == value; });
+	}
+
+	/* Splice functions */
+	/**
+         * @brief Moves every element of another list to the end of this one.
+         *
+         * Only the links at the two ends are changed, so this takes O(1)
+         * time, see @ref splice() for the conditions.
+         *
+         * @param other The list to take the elements from, left empty.
+         */
+	void append(SinglyLinkedList&& other) { splice(end_cursor(), other); }
+
+	/**
+         * @brief Adds the elements of a range at the start of the list in
+         *        turn, as @ref add_first() would, so that the last element
+         *        of the range ends up first.
+         *
+         * The new nodes are linked to each other and hooked onto the start
+         * of the list in one step. If copying an element throws, the nodes
+         * made so far are freed and the list is left unchanged.
+         *
+         * @param first Input iterator to the first element to add.
+         * @param last Input iterator past the last element to add.
+         */
+	template <typename InputIt>
+	void prepend_reversed(InputIt first, InputIt last)
+	{
+		Node* chain = nullptr;
+		Node* end = nullptr;
+		size_t n = 0;
+		try {
+			for (; first != last; ++first) {
+				Node* x = new_node(*first);
+				x->next = chain;
+				chain = x;
+				if (end == nullptr) {
+					end = x;
+				}
+				n++;
+			}
+		} catch (...) {
+			while (chain != nullptr) {
+				Node* next = chain->next;
+				pool->destroy(chain);
+				chain = next;
+			}
+			throw;
+		}
+		if (n == 0) {
+			return;
+		}
+		end->next = head.next;
+		head.next = chain;
+		if (size == 0) {
+			tail = end;
+		}
+		size += n;
+	}
+
+	/**
+         * @brief Moves every element of another list in front of a cursor.
+         *
+         * The nodes are relinked without being copied, which needs both
+         * lists to allocate from the same pool. If they do not, one pool is
+         * merged into the other when only one list uses it, after which both
+         * lists share it. Only if both pools are shared with further lists
+         * are the elements copied over instead, in O(n).
+         *
+         * Afterwards @p pos is at the first moved element.
+         *
+         * @param pos Cursor into this list.
+         * @param other The list to take the elements from, left empty.
+         */
+	void splice(Cursor pos, SinglyLinkedList& other)
+	{
+		if (&other == this || other.is_empty()) {
+			return;
+		}
+		splice(pos, other, other.cursor(), other.end_cursor(),
+		       other.size);
+	}
+
+	/**
+         * @brief Moves the elements in [@p first, @p last) of another list,
+         *        or of this one, in front of a cursor.
+         *
+         * Counting the moved elements takes O(k) time, use the overload
+         * taking the count to make this O(1).
+         *
+         * @param pos Cursor into this list, not inside the moved range.
+         * @param other The list to take the elements from.
+         * @param first Cursor at the first element to move.
+         * @param last Cursor after the last element to move.
+         */
+	void splice(Cursor pos, SinglyLinkedList& other, Cursor first,
+		    Cursor last)
+	{
+		size_t n = 0;
+		for (Link* p = first.prev; p != last.prev; p = p->next) {
+			n++;
+		}
+		splice(pos, other, first, last, n);
+	}
+
+	/**
+         * @brief Moves the @p n elements in [@p first, @p last) of another
+         *        list, or of this one, in front of a cursor in O(1).
+         *
+         * Cursors of either list at the element after the range are
+         * invalidated, as they refer to the last moved node.
+         *
+         * @param pos Cursor into this list, not inside the moved range.
+         * @param other The list to take the elements from.
+         * @param first Cursor at the first element to move.
+         * @param last Cursor after the last element to move.
+         * @param n The number of elements in the range.
+         */
+	void splice(Cursor pos, SinglyLinkedList& other, Cursor first,
+		    Cursor last, size_t n)
+	{
+		if (n == 0 || pos.prev == first.prev || pos.prev == last.prev) {
+			return;
+		}
+		if (!share_pool(other)) {
+			for (size_t i = 0; i < n; i++) {
+				pos.insert_before(first.get());
+				first.erase();
+			}
+			return;
+		}
+		Link* before = first.prev;
+		Node* a = before->next;
+		Node* b = static_cast<Node*>(last.prev);
+		before->next = b->next;
+		if (other.tail == b) {
+			other.tail = before;
+		}
+		other.size -= n;
+		b->next = pos.prev->next;
+		pos.prev->next = a;
+		if (tail == pos.prev) {
+			tail = b;
+		}
+		size += n;
+	}
+
+	/**
+         * @brief Splits the list in two at a cursor.
+         *
+         * The elements from @p pos to the end are relinked into a new list
+         * sharing this list's pool. Counting them takes O(k) time.
+         *
+         * @param pos Cursor into this list.
+         * @return A list holding the elements from @p pos on.
+         */
+	SinglyLinkedList split_at(Cursor pos)
+	{
+		SinglyLinkedList rest;
+		rest.pool = pool;
+		size_t n = 0;
+		for (Node* p = pos.prev->next; p != nullptr; p = p->next) {
+			n++;
+		}
+		rest.splice(rest.end_cursor(), *this, pos, end_cursor(), n);
+		return rest;
+	}
+
+	/* Sorting functions */
+	/**
+         * @brief Sorts the list, keeping equal elements in their order.
+         *
+         * A bottom-up merge sort that only relinks the nodes, so no element
+         * is copied and nothing is allocated. Runs of 1, 2, 4, ... sorted
+         * nodes are kept in a fixed array of bins, and every new node is
+         * carried up through the bins, merging with each occupied one, like
+         * incrementing a binary counter. Takes O(n log n) time.
+         *
+         * @param comp Strict weak ordering of the elements.
+         */
+	template <typename Compare = std::less<T>>
+	void sort(Compare comp = Compare())
+	{
+		if (size < 2) {
+			return;
+		}
+		Node* bins[64] = {};
+		size_t used = 0;
+		Node* p = head.next;
+		while (p != nullptr) {
+			Node* carry = p;
+			p = p->next;
+			carry->next = nullptr;
+			size_t i = 0;
+			for (; bins[i] != nullptr; i++) {
+				carry = merge_chains(bins[i], carry, comp);
+				bins[i] = nullptr;
+			}
+			bins[i] = carry;
+			if (i == used) {
+				used++;
+			}
+		}
+		Node* sorted = nullptr;
+		for (size_t i = 0; i < used; i++) {
+			if (bins[i] != nullptr) {
+				sorted = merge_chains(bins[i], sorted, comp);
+			}
+		}
+		head.next = sorted;
+		Node* last = sorted;
+		while (last->next != nullptr) {
+			last = last->next;
+		}
+		tail = last;
+	}
+
+	/**
+         * @brief Merges another sorted list into this sorted one.
+         *
+         * The nodes are relinked in O(n + m) time, elements of this list
+         * coming before equal ones of @p other. The lists need to share a
+         * pool as for @ref splice(), otherwise the elements of @p other are
+         * copied first.
+         *
+         * @param other A list sorted by @p comp, left empty.
+         * @param comp Strict weak ordering both lists are sorted by.
+         */
+	template <typename Compare = std::less<T>>
+	void merge(SinglyLinkedList& other, Compare comp = Compare())
+	{
+		if (&other == this || other.is_empty()) {
+			return;
+		}
+		if (!share_pool(other)) {
+			SinglyLinkedList copy(pool);
+			copy.splice(copy.end_cursor(), other);
+			merge(copy, comp);
+			return;
+		}
+		// Equal last elements end up in the order of the lists.
+		Link* last = other.tail;
+		if (size != 0 && comp(static_cast<Node*>(other.tail)->data,
+				      static_cast<Node*>(tail)->data)) {
+			last = tail;
+		}
+		head.next = merge_chains(head.next, other.head.next, comp);
+		tail = last;
+		size += other.size;
+		other.head.next = nullptr;
+		other.tail = &other.head;
+		other.size = 0;
+	}
+
+	/**
+         * @brief Merges several sorted lists into this sorted one.
+         *
+         * The lists are merged pairwise in rounds, so every element takes
+         * part in O(log k) merges for k lists. Equal elements keep the order
+         * of their lists, this one first.
+         *
+         * @param others Lists sorted by @p comp, left empty.
+         * @param comp Strict weak ordering all lists are sorted by.
+         */
+	template <typename Compare = std::less<T>>
+	void merge(const std::vector<SinglyLinkedList*>& others,
+		   Compare comp = Compare())
+	{
+		size_t k = others.size();
+		for (size_t step = 1; step < k; step *= 2) {
+			for (size_t i = 0; i + step < k; i += 2 * step) {
+				others[i]->merge(*others[i + step], comp);
+			}
+		}
+		if (k > 0) {
+			merge(*others[0], comp);
+		}
+	}
+
+	/* Iterators */
+	/** @brief Iterator to the first element. */
+	iterator begin() { return iterator(head.next); }
+
+	/** @brief Iterator past the last element. */
+	iterator end() { return iterator(nullptr); }
+
+	/** @brief Const iterator to the first element. */
+	const_iterator begin() const { return const_iterator(head.next); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator end() const { return const_iterator(nullptr); }
+
+	/** @brief Const iterator to the first element. */
+	const_iterator cbegin() const { return begin(); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator cend() const { return end(); }
+
+	/**
+         * @brief Get a cursor at the first element, for editing the list
+         *        while walking it.
+         * @return A cursor at the first element, or at the end if the list
+         *         is empty.
+         */
+	Cursor cursor() { return Cursor(this, &head); }
+
+	/**
+         * @brief Get a cursor past the last element, where
+         *        @ref Cursor::insert_before() appends.
+         * @return A cursor at the end.
+         */
+	Cursor end_cursor() { return Cursor(this, tail); }
+
 	/* Utility functions */
+	/**
+         * @brief Exchanges the elements and pools of two lists in O(1).
+         * @param other The list to swap with.
+         */
+	void swap(SinglyLinkedList& other) noexcept
+	{
+		std::swap(head.next, other.head.next);
+		std::swap(tail, other.tail);
+		std::swap(size, other.size);
+		pool.swap(other.pool);
+		if (tail == &other.head) {
+			tail = &head;
+		}
+		if (other.tail == &head) {
+			other.tail = &other.head;
+		}
+	}
+
+	/**
+         * @brief Deletes every node in the list.
+         *
+         * If no other list shares the node pool, its slabs are freed as a
+         * whole instead of giving back the nodes one at a time, and for
+         * trivially destructible elements the nodes are not even visited.
+         */
+	void clear()
+	{
+		release_nodes();
+		head.next = nullptr;
+		tail = &head;
+		size = 0;
+	}
+
+	/**
+         * @brief Moves every element into new nodes laid out one after
+         *        another in list order, in a single slab of a new pool.
+         *
+         * Works like @ref DoublyLinkedList::compact(): the old pool is freed
+         * unless other lists share it, elements are moved if that cannot
+         * throw, and iterators and cursors are invalidated.
+         */
+	void compact()
+	{
+		if (size == 0) {
+			release_nodes();
+			pool.reset();
+			return;
+		}
+		std::shared_ptr<Pool> fresh = std::make_shared<Pool>();
+		fresh->reserve(size);
+		Link chain;
+		Link* last = &chain;
+		try {
+			for (Node* p = head.next; p != nullptr; p = p->next) {
+				Node* x = fresh->create(
+					std::move_if_noexcept(p->data));
+				last->next = x;
+				last = x;
+			}
+		} catch (...) {
+			for (Node* p = chain.next; p != nullptr;) {
+				Node* next = p->next;
+				fresh->destroy(p);
+				p = next;
+			}
+			throw;
+		}
+		release_nodes();
+		pool = fresh;
+		head.next = chain.next;
+		tail = last;
+	}
+
+	/**
+         * @brief Copies the elements into a flat array in list order, for
+         *        scan heavy phases in which the list is only read.
+         * @return The elements in list order.
+         */
+	std::vector<T> freeze() const
+	{
+		std::vector<T> flat;
+		flat.reserve(size);
+		for (const T& x : *this) {
+			flat.push_back(x);
+		}
+		return flat;
+	}
+
+	/**
+         * @brief Get the pool the nodes are allocated from, creating it if
+         *        the list has none yet.
+         *
+         * The pool can be passed to the constructor of another list, which
+         * then reuses the nodes freed by this one and vice versa.
+         *
+         * @return The node pool.
+         */
+	std::shared_ptr<Pool> get_pool()
+	{
+		if (!pool) {
+			pool = std::make_shared<Pool>();
+		}
+		return pool;
+	}
+
 	/** 
          * @brief Get the current size of the singly linked list.
          * @return Current size of the singly linked list.
@@ -290,7 +825,7 @@ public:
 	void display() const
 	{
 		std::cout << "Size = " << size << '\n';
-		Node* p = head->next;
+		Node* p = head.next;
 		while (p != tail) {
 			std::cout << p->data << "->";
 			p = p->next;
@@ -300,10 +835,16 @@ public:
 	}
 
 private:
+	/** @brief Link shared by the element nodes and the head. */
+	struct Link {
+		Node* next; /** Pointer to the next node. */
+
+		Link() : next(nullptr) {}
+	};
+
 	/** @brief Struct representing a node in a singly linked list */
-	struct Node {
+	struct Node : Link {
 		T data; /** The data stored in the node. */
-		Node* next; /** Pointer to the next node. */
 
 		/**
                  * @brief Constructs a new node with given data and
@@ -311,14 +852,106 @@ private:
                  *
                  * @param val The value of the data to store in the node.
                  */
-		Node(T val) : data(val), next(nullptr) {}
+		Node(T val) : data(std::move(val)) {}
 	};
-	/** Dummy head node. */
-	Node* head;
-	/** Actual tail node. */
-	Node* tail;
+	/** Head embedded in the list, before the first element. */
+	Link head;
+	/** Actual tail node, the head while the list is empty. */
+	Link* tail;
 	/** Current size of the linked list. */
 	size_t size;
+	/** Pool of the element nodes, created along with the first one. */
+	std::shared_ptr<Pool> pool;
+
+	/**
+         * @brief Allocates a node from the pool.
+         * @param data The data to store in the node.
+         * @return Pointer to the new node.
+         */
+	Node* new_node(const T& data) { return get_pool()->create(data); }
+
+	/**
+         * @brief Makes this list and @p other allocate from the same pool,
+         *        merging one pool into the other if only one list uses it.
+         * @return false if both pools are also used by further lists.
+         */
+	bool share_pool(SinglyLinkedList& other)
+	{
+		if (pool == other.pool) {
+			return true;
+		}
+		if (!pool) {
+			pool = other.pool;
+			return true;
+		}
+		if (!other.pool) {
+			other.pool = pool;
+			return true;
+		}
+		if (other.pool.use_count() == 1) {
+			pool->merge(*other.pool);
+			other.pool = pool;
+			return true;
+		}
+		if (pool.use_count() == 1) {
+			other.pool->merge(*pool);
+			pool = other.pool;
+			return true;
+		}
+		return false;
+	}
+
+	/**
+         * @brief Merges two null terminated sorted chains of nodes, taking
+         *        from @p a first on ties.
+         * @return The first node of the merged chain.
+         */
+	template <typename Compare>
+	static Node* merge_chains(Node* a, Node* b, Compare& comp)
+	{
+		Node* first = nullptr;
+		Node** link = &first;
+		while (a != nullptr && b != nullptr) {
+			if (comp(b->data, a->data)) {
+				*link = b;
+				link = &b->next;
+				b = b->next;
+			} else {
+				*link = a;
+				link = &a->next;
+				a = a->next;
+			}
+		}
+		*link = a != nullptr ? a : b;
+		return first;
+	}
+
+	/**
+         * @brief Frees every element node, leaving the links of the head
+         *        untouched.
+         */
+	void release_nodes()
+	{
+		if (!pool) {
+			return;
+		}
+		bool sole = pool.use_count() == 1;
+		if (!sole || !std::is_trivially_destructible<T>::value) {
+			Node* p = head.next;
+			while (p != nullptr) {
+				Node* next = p->next;
+				if (sole) {
+					p->~Node();
+				} else {
+					pool->destroy(p);
+				}
+				p = next;
+			}
+		}
+		if (sole) {
+			pool->release();
+		}
+	}
 
 	/** 
          * @brief Get the requested node.
@@ -332,7 +965,7 @@ private:
 	Node* get_node(int index) const
 	{
 		check_element_index(index);
-		Node* p = head->next;
+		Node* p = head.next;
 		for (int i = 0; i < index; i++) {
 			p = p->next;
 		}
@@ -396,6 +1029,178 @@ private:
 	}
 };
 
+/**
+ * @class SinglyLinkedList::Cursor
+ * @brief Position in a SinglyLinkedList at which elements can be inserted
+ *        and erased in O(1).
+ *
+ * The cursor keeps the node before the current element, which is what a
+ * singly linked list needs to unlink the current element or link a new one
+ * in front of it. It stays valid across its own edits, but any edit made
+ * through the list or another cursor near it may invalidate it.
+ */
+template <typename T>
+class SinglyLinkedList<T>::Cursor {
+public:
+	/**
+         * @brief Check if the cursor is past the last element.
+         * @return true if there is no current element.
+         */
+	bool is_end() const { return prev->next == nullptr; }
+
+	/**
+         * @brief Get the current element.
+         * @return Reference to the current element.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	T& get() const
+	{
+		check_not_end();
+		return prev->next->data;
+	}
+
+	/**
+         * @brief Moves the cursor to the next element.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	void advance()
+	{
+		check_not_end();
+		prev = prev->next;
+	}
+
+	/**
+         * @brief Inserts an element before the current one, the cursor
+         *        staying on the current element. At the end, this appends.
+         * @param data The element to be inserted.
+         */
+	void insert_before(const T& data)
+	{
+		Node* x = list->new_node(data);
+		x->next = prev->next;
+		prev->next = x;
+		if (list->tail == prev) {
+			list->tail = x;
+		}
+		prev = x;
+		list->size++;
+	}
+
+	/**
+         * @brief Inserts an element after the current one, the cursor
+         *        staying on the current element.
+         * @param data The element to be inserted.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	void insert_after(const T& data)
+	{
+		check_not_end();
+		Node* cur = prev->next;
+		Node* x = list->new_node(data);
+		x->next = cur->next;
+		cur->next = x;
+		if (list->tail == cur) {
+			list->tail = x;
+		}
+		list->size++;
+	}
+
+	/**
+         * @brief Deletes the current element, moving the cursor to the
+         *        next one.
+         * @return The deleted element.
+         * @throws std::out_of_range if the cursor is at the end.
+         */
+	T erase()
+	{
+		check_not_end();
+		Node* x = prev->next;
+		prev->next = x->next;
+		if (list->tail == x) {
+			list->tail = prev;
+		}
+		list->size--;
+		T data = x->data;
+		list->pool->destroy(x);
+		return data;
+	}
+
+private:
+	friend class SinglyLinkedList;
+
+	/** The list the cursor walks. */
+	SinglyLinkedList* list;
+	/** Node before the current element, possibly the head. */
+	Link* prev;
+
+	Cursor(SinglyLinkedList* l, Link* p) : list(l), prev(p) {}
+
+	void check_not_end() const
+	{
+		if (is_end()) {
+			throw std::out_of_range(
+				"Cursor is past the last element");
+		}
+	}
+};
+
+/**
+ * @brief Forward iterator over a SinglyLinkedList.
+ */
+template <typename T>
+template <bool IsConst>
+class SinglyLinkedList<T>::Iterator {
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+	typedef typename std::conditional<IsConst, const T&, T&>::type
+		reference;
+
+	Iterator() : cur(nullptr) {}
+
+	explicit Iterator(Node* n) : cur(n) {}
+
+	// Allows an iterator to be passed where a const_iterator is expected.
+	template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+	Iterator(const Iterator<false>& other) : cur(other.cur)
+	{
+	}
+
+	reference operator*() const { return cur->data; }
+
+	pointer operator->() const { return &cur->data; }
+
+	Iterator& operator++()
+	{
+		cur = cur->next;
+		return *this;
+	}
+
+	Iterator operator++(int)
+	{
+		Iterator old = *this;
+		cur = cur->next;
+		return old;
+	}
+
+	bool operator==(const Iterator& other) const
+	{
+		return cur == other.cur;
+	}
+
+	bool operator!=(const Iterator& other) const
+	{
+		return cur != other.cur;
+	}
+
+private:
+	friend class Iterator<!IsConst>;
+
+	Node* cur;
+};
+
 } // namespace DataStructures
 
 #endif // DATA_STRUCTURES_LINKED_LIST_H
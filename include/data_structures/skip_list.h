@@ -0,0 +1,727 @@
+#ifndef DATA_STRUCTURES_SKIP_LIST_H
+#define DATA_STRUCTURES_SKIP_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include "node_pool.h"
+
+namespace DataStructures {
+
+/**
+ * @class SkipList
+ * @brief Sorted indexable skip list with all related functionality.
+ *
+ * Every node is linked on the bottom level and, with probability 1/4 per
+ * level, on each level above, so a search skips over most nodes by starting
+ * on the highest level and dropping down whenever it would overshoot. Each
+ * forward link also records its width, the number of elements it jumps
+ * over, which lets the same descent count positions. Lookup, insertion and
+ * removal by key as well as by index thus take O(log n) expected time.
+ *
+ * The elements are kept in the order given by @p Compare, equal elements in
+ * the order they were added. Nodes of each height are allocated from their
+ * own @ref SlabPool, created along with the first node of that height.
+ *
+ * @tparam T Type of the implementation class.
+ * @tparam Compare Strict weak ordering of the elements.
+ */
+template <typename T, typename Compare = std::less<T>>
+class SkipList {
+	struct Node;
+
+	class Iterator;
+
+public:
+	typedef Iterator iterator;
+	typedef Iterator const_iterator;
+
+	/**
+         * @brief Constructor for an empty SkipList.
+         * @param compare The ordering of the elements.
+         */
+	explicit SkipList(const Compare& compare = Compare())
+		: comp(compare)
+		, level(1)
+		, size(0)
+		, state(0x9E3779B97F4A7C15ULL ^
+			reinterpret_cast<uintptr_t>(this))
+	{
+		reset_head();
+	}
+
+	/**
+         * @brief Destructor for the SkipList class.
+         *
+         * Destroys every element and frees every node.
+         */
+	~SkipList() { release_nodes(); }
+
+	SkipList(const SkipList&) = delete;
+	SkipList& operator=(const SkipList&) = delete;
+
+	/**
+         * @brief Move constructor, taking over the nodes of another list in
+         *        O(1) and leaving it empty.
+         * @param other The list to move from.
+         */
+	SkipList(SkipList&& other) noexcept : SkipList(other.comp)
+	{
+		swap(other);
+	}
+
+	/**
+         * @brief Move assignment, freeing the current nodes and taking over
+         *        those of another list in O(1).
+         * @param other The list to move from, left empty.
+         * @return Reference to this list.
+         */
+	SkipList& operator=(SkipList&& other) noexcept
+	{
+		SkipList old(std::move(other));
+		swap(old);
+		return *this;
+	}
+
+	/* Add functions */
+	/**
+         * @brief Adds an element at its place in the order, after any equal
+         *        elements.
+         * @param data The element to be added.
+         */
+	void add(const T& data)
+	{
+		Link* update[max_level] = {};
+		size_t rank[max_level];
+		Link* x = head;
+		size_t pos = 0;
+		for (size_t l = level; l-- > 0;) {
+			while (x[l].next != nullptr &&
+			       !comp(data, x[l].next->data)) {
+				pos += x[l].width;
+				x = x[l].next->links();
+			}
+			update[l] = x;
+			rank[l] = pos;
+		}
+		link(update, rank, data);
+	}
+
+	/**
+         * @brief Adds an element at a valid position index.
+         *
+         * Useful to add next to a known position without comparing against
+         * the elements on the way there. The element still has to fit the
+         * order at that position.
+         *
+         * @param pos_index Position index at which the element is to be
+         *                  added.
+         * @param data The element to be added.
+         * @throws std::out_of_range if @p pos_index is not in [0, size].
+         * @throws std::invalid_argument if @p data does not belong at
+         *         @p pos_index in the order.
+         */
+	void add(int pos_index, const T& data)
+	{
+		check_position_index(pos_index);
+		Link* update[max_level] = {};
+		size_t rank[max_level];
+		Node* prev = nullptr;
+		Link* x = head;
+		size_t pos = 0;
+		size_t target = size_t(pos_index);
+		for (size_t l = level; l-- > 0;) {
+			while (x[l].next != nullptr &&
+			       pos + x[l].width <= target) {
+				pos += x[l].width;
+				prev = x[l].next;
+				x = prev->links();
+			}
+			update[l] = x;
+			rank[l] = pos;
+		}
+		Node* next = x[0].next;
+		if ((prev != nullptr && comp(data, prev->data)) ||
+		    (next != nullptr && comp(next->data, data))) {
+			throw std::invalid_argument(
+				"Element does not belong at Position Index: " +
+				std::to_string(pos_index));
+		}
+		link(update, rank, data);
+	}
+
+	/* Erase functions */
+	/**
+         * @brief Deletes the first element.
+         * @return The deleted element.
+         * @throws std::out_of_range if the list is empty. The exception message
+         *         states that there are "No nodes to remove".
+         */
+	T del_first()
+	{
+		if (is_empty()) {
+			throw std::out_of_range("No nodes to remove");
+		}
+		Link* update[max_level] = {};
+		for (size_t l = 0; l < level; l++) {
+			update[l] = head;
+		}
+		return unlink(update);
+	}
+
+	/**
+         * @brief Deletes the last element.
+         * @return The deleted element.
+         * @throws std::out_of_range if the list is empty. The exception message
+         *         states that there are "No nodes to remove".
+         */
+	T del_last()
+	{
+		if (is_empty()) {
+			throw std::out_of_range("No nodes to remove");
+		}
+		return del(int(size) - 1);
+	}
+
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_last();
+		return true;
+	}
+
+	/**
+         * @brief Deletes the element at a particular index.
+         * @param index Index of the element.
+         * @return The deleted element.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	T del(int index)
+	{
+		check_element_index(index);
+		Link* update[max_level] = {};
+		Link* x = head;
+		size_t pos = 0;
+		size_t target = size_t(index);
+		for (size_t l = level; l-- > 0;) {
+			while (pos + x[l].width <= target) {
+				pos += x[l].width;
+				x = x[l].next->links();
+			}
+			update[l] = x;
+		}
+		return unlink(update);
+	}
+
+	/**
+         * @brief Deletes every element equal to a given one.
+         * @param data The element to be removed.
+         * @return The number of deleted elements.
+         */
+	size_t remove(const T& data)
+	{
+		Link* update[max_level] = {};
+		find_lower(data, update);
+		size_t count = 0;
+		while (update[0][0].next != nullptr &&
+		       !comp(data, update[0][0].next->data)) {
+			unlink(update);
+			count++;
+		}
+		return count;
+	}
+
+	/**
+         * @brief Deletes every element.
+         */
+	void clear()
+	{
+		release_nodes();
+		reset_head();
+		level = 1;
+		size = 0;
+	}
+
+	/* Get functions */
+	/**
+         * @brief Get the first, smallest element.
+         * @return The first element.
+         * @throws std::out_of_range when the list is empty. The exception
+         *         message states that there are "No nodes in the list".
+         */
+	T get_first() const
+	{
+		if (is_empty()) {
+			throw std::out_of_range("No nodes in the list");
+		}
+		return head[0].next->data;
+	}
+
+	/**
+         * @brief Get the last, largest element.
+         * @return The last element.
+         * @throws std::out_of_range when the list is empty. The exception
+         *         message states that there are "No nodes in the list".
+         */
+	T get_last() const
+	{
+		if (is_empty()) {
+			throw std::out_of_range("No nodes in the list");
+		}
+		return get_node(int(size) - 1)->data;
+	}
+
+	/**
+         * @brief Get the element at a particular index.
+         * @param index Index of the element.
+         * @return The requested element.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	T get(int index) const { return get_node(index)->data; }
+
+	/**
+         * @brief Get the index of the first element equal to a given one.
+         * @param data The element to look for.
+         * @return Its index, or -1 if there is no such element.
+         */
+	int index_of(const T& data) const
+	{
+		const Link* x = head;
+		size_t pos = 0;
+		for (size_t l = level; l-- > 0;) {
+			while (x[l].next != nullptr &&
+			       comp(x[l].next->data, data)) {
+				pos += x[l].width;
+				x = x[l].next->links();
+			}
+		}
+		if (x[0].next == nullptr || comp(data, x[0].next->data)) {
+			return -1;
+		}
+		return int(pos);
+	}
+
+	/**
+         * @brief Check if an element equal to a given one is in the list.
+         * @param data The element to look for.
+         * @return true if there is such an element, false otherwise.
+         */
+	bool contains(const T& data) const { return index_of(data) != -1; }
+
+	/* Iterators */
+	/** @brief Iterator to the first element. */
+	const_iterator begin() const { return const_iterator(head[0].next); }
+
+	/** @brief Iterator past the last element. */
+	const_iterator end() const { return const_iterator(nullptr); }
+
+	/** @brief Iterator to the first element. */
+	const_iterator cbegin() const { return begin(); }
+
+	/** @brief Iterator past the last element. */
+	const_iterator cend() const { return end(); }
+
+	/* Utility functions */
+	/**
+         * @brief Exchanges the elements, pools and orderings of two lists.
+         *
+         * Only the links of the heads are swapped, which takes time in the
+         * maximum number of levels but not in the number of elements.
+         *
+         * @param other The list to swap with.
+         */
+	void swap(SkipList& other)
+	{
+		std::swap(comp, other.comp);
+		for (size_t l = 0; l < max_level; l++) {
+			std::swap(head[l], other.head[l]);
+			pools[l].swap(other.pools[l]);
+		}
+		std::swap(level, other.level);
+		std::swap(size, other.size);
+		std::swap(state, other.state);
+	}
+
+	/**
+         * @brief Get the current size of the skip list.
+         * @return Current number of elements.
+         */
+	size_t get_size() const { return size; }
+
+	/**
+         * @brief Check if the skip list is empty.
+         * @return true if the list contains no elements, false otherwise.
+         */
+	bool is_empty() const { return size == 0; }
+
+	/**
+         * @brief Display the values in the skip list.
+         */
+	void display() const
+	{
+		std::cout << "Size = " << size << '\n';
+		for (Node* p = head[0].next; p != nullptr;
+		     p = p->links()[0].next) {
+			std::cout << p->data << "->";
+		}
+		std::cout << "nullptr" << '\n';
+		std::cout << '\n';
+	}
+
+private:
+	/** Number of levels a node can be linked on. */
+	static const size_t max_level = 32;
+
+	/** @brief Forward link of a node on one level. */
+	struct Link {
+		/** Next node on the level, nullptr at the end. */
+		Node* next;
+		/** Number of positions the link advances. */
+		size_t width;
+	};
+
+	/**
+         * @brief Struct representing a node in a skip list.
+         *
+         * The node is followed in its block by one @ref Link for each level
+         * it is linked on.
+         */
+	struct Node {
+		T data; /** The data stored in the node. */
+		size_t height; /** Number of levels the node is linked on. */
+
+		Node(const T& val, size_t h) : data(val), height(h) {}
+
+		/** @brief Offset of the links from the start of the node. */
+		static size_t links_offset()
+		{
+			return (sizeof(Node) + alignof(Link) - 1) /
+			       alignof(Link) * alignof(Link);
+		}
+
+		Link* links()
+		{
+			return reinterpret_cast<Link*>(
+				reinterpret_cast<unsigned char*>(this) +
+				links_offset());
+		}
+
+		const Link* links() const
+		{
+			return reinterpret_cast<const Link*>(
+				reinterpret_cast<const unsigned char*>(this) +
+				links_offset());
+		}
+	};
+
+	/** Ordering of the elements. */
+	Compare comp;
+	/** Links of the head, before the first element on every level. */
+	Link head[max_level];
+	/** Number of levels in use, at least one. */
+	size_t level;
+	/** Current number of elements. */
+	size_t size;
+	/** State of the generator of node heights. */
+	uint64_t state;
+	/** Pools of the nodes, one for every height. */
+	std::unique_ptr<SlabPool> pools[max_level];
+
+	/** @brief Empties the links of the head on every level. */
+	void reset_head()
+	{
+		for (size_t l = 0; l < max_level; l++) {
+			head[l].next = nullptr;
+			head[l].width = 1;
+		}
+	}
+
+	/**
+         * @brief Draws a node height, each level above the first with
+         *        probability 1/4.
+         */
+	size_t random_height()
+	{
+		state ^= state >> 12;
+		state ^= state << 25;
+		state ^= state >> 27;
+		uint64_t r = state * 2685821657736338717ULL;
+		size_t h = 1;
+		while ((r & 3) == 0 && h < max_level) {
+			h++;
+			r >>= 2;
+		}
+		return h;
+	}
+
+	/**
+         * @brief Allocates a node of a given height from its pool.
+         * @param data The data to store in the node.
+         * @param h The number of levels the node is linked on.
+         * @return Pointer to the new node.
+         */
+	Node* new_node(const T& data, size_t h)
+	{
+		std::unique_ptr<SlabPool>& pool = pools[h - 1];
+		if (!pool) {
+			size_t align = alignof(Node) > alignof(Link)
+					       ? alignof(Node)
+					       : alignof(Link);
+			size_t bytes = Node::links_offset() + h * sizeof(Link);
+			pool.reset(new SlabPool(bytes, align));
+		}
+		void* p = pool->allocate();
+		Node* x;
+		try {
+			x = new (p) Node(data, h);
+		} catch (...) {
+			pool->deallocate(p);
+			throw;
+		}
+		Link* links = x->links();
+		for (size_t l = 0; l < h; l++) {
+			new (&links[l]) Link();
+		}
+		return x;
+	}
+
+	/** @brief Destroys a node and gives its block back to its pool. */
+	void destroy(Node* x)
+	{
+		size_t h = x->height;
+		x->~Node();
+		pools[h - 1]->deallocate(x);
+	}
+
+	/**
+         * @brief Frees every node, leaving the links of the head untouched.
+         *
+         * The pools are freed wholesale, so the nodes themselves only need
+         * to be visited if the elements have destructors to run.
+         */
+	void release_nodes()
+	{
+		if (!std::is_trivially_destructible<T>::value) {
+			Node* p = head[0].next;
+			while (p != nullptr) {
+				Node* next = p->links()[0].next;
+				p->~Node();
+				p = next;
+			}
+		}
+		for (size_t h = 0; h < max_level; h++) {
+			if (pools[h]) {
+				pools[h]->release();
+			}
+		}
+	}
+
+	/**
+         * @brief Links a new node after the links in @p update.
+         * @param update The links before the new node on every level in use.
+         * @param rank The position of every link in @p update, the head
+         *             being at position zero.
+         * @param data The data to store in the new node.
+         */
+	void link(Link** update, size_t* rank, const T& data)
+	{
+		size_t h = random_height();
+		Node* x = new_node(data, h);
+		for (; level < h; level++) {
+			head[level].width = size + 1;
+			update[level] = head;
+			rank[level] = 0;
+		}
+		Link* links = x->links();
+		for (size_t l = 0; l < h; l++) {
+			Link& prev = update[l][l];
+			links[l].next = prev.next;
+			links[l].width = prev.width - (rank[0] - rank[l]);
+			prev.next = x;
+			prev.width = rank[0] - rank[l] + 1;
+		}
+		for (size_t l = h; l < level; l++) {
+			update[l][l].width++;
+		}
+		size++;
+	}
+
+	/**
+         * @brief Unlinks and frees the node after the links in @p update.
+         *
+         * The links stay in front of the following node afterwards.
+         *
+         * @param update The links before the node on every level in use.
+         * @return The data of the freed node.
+         */
+	T unlink(Link** update)
+	{
+		Node* x = update[0][0].next;
+		Link* links = x->links();
+		for (size_t l = 0; l < level; l++) {
+			Link& prev = update[l][l];
+			if (prev.next == x) {
+				prev.next = links[l].next;
+				prev.width += links[l].width - 1;
+			} else {
+				prev.width--;
+			}
+		}
+		while (level > 1 && head[level - 1].next == nullptr) {
+			level--;
+		}
+		size--;
+		T data = std::move(x->data);
+		destroy(x);
+		return data;
+	}
+
+	/**
+         * @brief Finds the links before the first element not less than a
+         *        given one on every level in use.
+         */
+	void find_lower(const T& data, Link** update)
+	{
+		Link* x = head;
+		for (size_t l = level; l-- > 0;) {
+			while (x[l].next != nullptr &&
+			       comp(x[l].next->data, data)) {
+				x = x[l].next->links();
+			}
+			update[l] = x;
+		}
+	}
+
+	/**
+         * @brief Get the node at a particular index.
+         * @param index Index of the desired node.
+         * @return Pointer to the requested node.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	Node* get_node(int index) const
+	{
+		check_element_index(index);
+		const Link* x = head;
+		size_t pos = 0;
+		size_t target = size_t(index) + 1;
+		for (size_t l = level; l-- > 0;) {
+			while (pos + x[l].width < target) {
+				pos += x[l].width;
+				x = x[l].next->links();
+			}
+		}
+		return x[0].next;
+	}
+
+	/**
+         * @brief Checks the given index and throws an exception if out of
+         *        range.
+         * @param index Index to be checked.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	void check_element_index(int index) const
+	{
+		if (index < 0 || index >= int(size)) {
+			throw std::out_of_range(
+				"Index: " + std::to_string(index) +
+				", Size: " + std::to_string(size));
+		}
+	}
+
+	/**
+         * @brief Checks the given position index and throws an exception if
+         *        out of range.
+         * @param pos_index Position index to be checked.
+         * @throws std::out_of_range if @p pos_index is not in [0, size].
+         */
+	void check_position_index(int pos_index) const
+	{
+		if (pos_index < 0 || pos_index > int(size)) {
+			throw std::out_of_range(
+				"Position Index: " + std::to_string(pos_index) +
+				", Size: " + std::to_string(size));
+		}
+	}
+};
+
+/**
+ * @brief Forward iterator over a SkipList, walking the bottom level.
+ *
+ * The elements are only handed out as const, as changing one could break
+ * the order.
+ */
+template <typename T, typename Compare>
+class SkipList<T, Compare>::Iterator {
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef const T* pointer;
+	typedef const T& reference;
+
+	Iterator() : node(nullptr) {}
+
+	explicit Iterator(Node* n) : node(n) {}
+
+	reference operator*() const { return node->data; }
+
+	pointer operator->() const { return &node->data; }
+
+	Iterator& operator++()
+	{
+		node = node->links()[0].next;
+		return *this;
+	}
+
+	Iterator operator++(int)
+	{
+		Iterator old = *this;
+		node = node->links()[0].next;
+		return old;
+	}
+
+	bool operator==(const Iterator& other) const
+	{
+		return node == other.node;
+	}
+
+	bool operator!=(const Iterator& other) const
+	{
+		return node != other.node;
+	}
+
+private:
+	Node* node;
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_SKIP_LIST_H
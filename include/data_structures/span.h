@@ -0,0 +1,72 @@
+#ifndef DATA_STRUCTURES_SPAN_H
+#define DATA_STRUCTURES_SPAN_H
+
+#include <cstddef>
+
+namespace DataStructures {
+
+/**
+ * @class Span
+ * @brief Non-owning view over a contiguous run of elements.
+ *
+ * Used by the array based containers to hand out their storage without
+ * copying, e.g. the two halves of a wrapped @ref CircularArray.
+ *
+ * @tparam T Type of the viewed elements, const qualified for read-only views.
+ */
+template <typename T>
+class Span {
+public:
+	/**
+         * @brief Constructs an empty span.
+         */
+	Span() : ptr(nullptr), len(0) {}
+
+	/**
+         * @brief Constructs a span over @p size elements starting at @p data.
+         * @param data Pointer to the first element.
+         * @param size Number of elements in the span.
+         */
+	Span(T* data, size_t size) : ptr(data), len(size) {}
+
+	/**
+         * @brief Get a pointer to the first element of the span.
+         * @return Pointer to the first element.
+         */
+	T* data() const { return ptr; }
+
+	/**
+         * @brief Get the number of elements in the span.
+         * @return Number of elements in the span.
+         */
+	size_t size() const { return len; }
+
+	/**
+         * @brief Check if the span is empty.
+         * @return true if the span has no elements, false otherwise.
+         */
+	bool empty() const { return len == 0; }
+
+	/**
+         * @brief Unchecked access to an element of the span.
+         * @param index Index of the element.
+         * @return Reference to the element.
+         */
+	T& operator[](size_t index) const { return ptr[index]; }
+
+	/** @brief Pointer to the first element, for range based loops. */
+	T* begin() const { return ptr; }
+
+	/** @brief Pointer one past the last element, for range based loops. */
+	T* end() const { return ptr + len; }
+
+private:
+	/** Pointer to the first element. */
+	T* ptr;
+	/** Number of elements. */
+	size_t len;
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_SPAN_H
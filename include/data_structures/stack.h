@@ -0,0 +1,244 @@
+#ifndef DATA_STRUCTURES_STACK_H
+#define DATA_STRUCTURES_STACK_H
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "backend_traits.h"
+#include "dynamic_array.h"
+
+namespace DataStructures {
+
+/**
+ * @class Stack
+ * @brief Stack adapter over any container described by @ref BackendTraits.
+ *
+ * The top of the stack is the end of the container when the container can
+ * add and delete there in O(1), otherwise its front, so that e.g. a
+ * @ref SinglyLinkedList works as a stack as well. A backend offering
+ * neither is rejected at compile time. Popping checks for an empty stack
+ * once and then deletes with the single removing operation of the backend.
+ *
+ * @tparam T Type of the elements.
+ * @tparam Container The backend container.
+ */
+template <typename T, typename Container = DynamicArray<T>>
+class Stack {
+	typedef BackendTraits<Container> Traits;
+
+	static_assert(std::is_same<typename Traits::value_type, T>::value,
+		      "Stack backend must hold elements of type T");
+
+	/** Whether the top of the stack is the end of the container. */
+	static const bool at_back =
+		Traits::fast_add_last && Traits::fast_del_last;
+	/** Whether the front of the container can serve as the top. */
+	static const bool at_front =
+		Traits::fast_add_first && Traits::fast_del_first;
+
+	static_assert(at_back || at_front,
+		      "Stack backend must add and delete at one end in O(1)");
+
+public:
+	/**
+         * @brief Push the element at the top of the stack.
+         * @param element The element to be pushed.
+         */
+	void push(const T& element)
+	{
+		if (at_back) {
+			Traits::add_last(c, element);
+		} else {
+			Traits::add_first(c, element);
+		}
+	}
+
+	/**
+         * @brief Pop the element from the top of the stack and return its
+         *        value.
+         * @return The value of the element that has been popped.
+         * @throws std::out_of_range if the stack is empty.
+         */
+	T pop()
+	{
+		if (Traits::empty(c)) {
+			throw std::out_of_range("Stack is empty");
+		}
+		return at_back ? Traits::del_last(c) : Traits::del_first(c);
+	}
+
+	/**
+         * @brief Get the value of the element at the top of the stack.
+         * @return The value of the element at the top of the stack.
+         * @throws std::out_of_range if the stack is empty.
+         */
+	T peek() const
+	{
+		if (Traits::empty(c)) {
+			throw std::out_of_range("Stack is empty");
+		}
+		return at_back ? Traits::get_last(c) : Traits::get_first(c);
+	}
+
+	/**
+         * @brief Get the current size of the stack.
+         * @return The current size of the stack.
+         */
+	size_t size() const { return Traits::size(c); }
+
+	/**
+         * @brief Check if the stack is empty.
+         * @return true if the stack has no elements, false otherwise.
+         */
+	bool is_empty() const { return Traits::empty(c); }
+
+	/**
+         * @brief Pop the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (Traits::empty(c)) {
+			return false;
+		}
+		out = at_back ? Traits::del_last(c) : Traits::del_first(c);
+		return true;
+	}
+
+	/**
+         * @brief Get the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (Traits::empty(c)) {
+			return false;
+		}
+		out = at_back ? Traits::get_last(c) : Traits::get_first(c);
+		return true;
+	}
+
+	/**
+         * @brief Pushes the elements of a range in order, so that the last
+         *        one ends up at the top of the stack.
+         *
+         * Backends that can reserve, such as @ref DynamicArray and
+         * @c std::vector, grow at most once for the whole range, and
+         * @ref DoublyLinkedList and @ref SinglyLinkedList link the new
+         * nodes in as one chain, leaving the stack unchanged if copying
+         * an element throws.
+         *
+         * @param first Forward iterator to the first element to push.
+         * @param last Forward iterator past the last element to push.
+         */
+	template <typename ForwardIt>
+	void push_n(ForwardIt first, ForwardIt last)
+	{
+		push_range(first, last,
+			   std::integral_constant<bool, at_back>());
+	}
+
+	/**
+         * @brief Pops @p count elements, writing them from the top down.
+         *
+         * @ref DynamicArray and @ref DoublyLinkedList move the elements out
+         * and then delete them at once, shrinking or relinking a single
+         * time.
+         *
+         * @param out Output iterator receiving the popped elements.
+         * @param count The number of elements to pop.
+         * @return The output iterator past the last written element.
+         * @throws std::out_of_range if the stack has fewer elements, in
+         *         which case nothing is popped.
+         */
+	template <typename OutputIt>
+	OutputIt pop_n(OutputIt out, size_t count)
+	{
+		if (count > Traits::size(c)) {
+			throw std::out_of_range(
+				"Stack has fewer elements than requested");
+		}
+		return pop_top(count, out,
+			       std::integral_constant<bool, at_back>());
+	}
+
+	/**
+         * @brief Get the values of the top @p count elements.
+         * @param count The number of elements.
+         * @return The values from the top of the stack down.
+         * @throws std::out_of_range if the stack has fewer elements.
+         */
+	std::vector<T> peek_n(size_t count) const
+	{
+		if (count > Traits::size(c)) {
+			throw std::out_of_range(
+				"Stack has fewer elements than requested");
+		}
+		std::vector<T> top;
+		top.reserve(count);
+		copy_top(count, std::back_inserter(top),
+			 std::integral_constant<bool, at_back>());
+		return top;
+	}
+
+	/**
+         * @brief Exchanges the contents of two stacks in O(1).
+         * @param other The stack to swap with.
+         */
+	void swap(Stack& other) noexcept { c.swap(other.c); }
+
+private:
+	/**
+         * The container used to internally implement the stack.
+         */
+	Container c;
+
+	/** @brief Pushes a range onto the end. */
+	template <typename ForwardIt>
+	void push_range(ForwardIt first, ForwardIt last, std::true_type)
+	{
+		Traits::append(c, first, last);
+	}
+
+	/** @brief Pushes a range onto the front. */
+	template <typename ForwardIt>
+	void push_range(ForwardIt first, ForwardIt last, std::false_type)
+	{
+		Traits::prepend_reversed(c, first, last);
+	}
+
+	/** @brief Pops the top @p count elements from the end. */
+	template <typename OutputIt>
+	OutputIt pop_top(size_t count, OutputIt out, std::true_type)
+	{
+		return Traits::del_last_n(c, count, out);
+	}
+
+	/** @brief Pops the top @p count elements from the front. */
+	template <typename OutputIt>
+	OutputIt pop_top(size_t count, OutputIt out, std::false_type)
+	{
+		return Traits::del_first_n(c, count, out);
+	}
+
+	/** @brief Copies the top @p count elements from the end. */
+	template <typename OutputIt>
+	void copy_top(size_t count, OutputIt out, std::true_type) const
+	{
+		Traits::copy_last(c, count, out);
+	}
+
+	/** @brief Copies the top @p count elements from the front. */
+	template <typename OutputIt>
+	void copy_top(size_t count, OutputIt out, std::false_type) const
+	{
+		Traits::copy_first(c, count, out);
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_STACK_H
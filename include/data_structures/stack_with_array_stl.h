@@ -1,6 +1,9 @@
 #ifndef DATA_STRUCTURES_STACK_WITH_ARRAY_STL_H
 #define DATA_STRUCTURES_STACK_WITH_ARRAY_STL_H
 
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 namespace DataStructures {
@@ -43,6 +46,99 @@ public:
          */
 	size_t size() const { return arr.size(); }
 
+	/**
+         * @brief Pop the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (arr.empty()) {
+			return false;
+		}
+		out = std::move(arr.back());
+		arr.pop_back();
+		return true;
+	}
+
+	/**
+         * @brief Get the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (arr.empty()) {
+			return false;
+		}
+		out = arr.back();
+		return true;
+	}
+
+	/**
+         * @brief Pushes the elements of a range in order, so that the last
+         *        one ends up at the top of the stack.
+         *
+         * The vector grows at most once and the elements are copied into it
+         * contiguously.
+         *
+         * @param first Forward iterator to the first element to push.
+         * @param last Forward iterator past the last element to push.
+         */
+	template <typename ForwardIt>
+	void push_n(ForwardIt first, ForwardIt last)
+	{
+		arr.insert(arr.end(), first, last);
+	}
+
+	/**
+         * @brief Pops @p count elements, writing them from the top down.
+         * @param out Output iterator receiving the popped elements.
+         * @param count The number of elements to pop.
+         * @return The output iterator past the last written element.
+         * @throws std::out_of_range if the stack has fewer elements, in
+         *         which case nothing is popped.
+         */
+	template <typename OutputIt>
+	OutputIt pop_n(OutputIt out, size_t count)
+	{
+		size_t n = arr.size();
+		if (count > n) {
+			throw std::out_of_range(
+				"Stack has fewer elements than requested");
+		}
+		for (size_t i = n; i > n - count; i--) {
+			*out++ = std::move(arr[i - 1]);
+		}
+		arr.erase(arr.end() - std::ptrdiff_t(count), arr.end());
+		return out;
+	}
+
+	/**
+         * @brief Get the values of the top @p count elements.
+         * @param count The number of elements.
+         * @return The values from the top of the stack down.
+         * @throws std::out_of_range if the stack has fewer elements.
+         */
+	std::vector<T> peek_n(size_t count) const
+	{
+		size_t n = arr.size();
+		if (count > n) {
+			throw std::out_of_range(
+				"Stack has fewer elements than requested");
+		}
+		std::vector<T> top;
+		top.reserve(count);
+		for (size_t i = n; i > n - count; i--) {
+			top.push_back(arr[i - 1]);
+		}
+		return top;
+	}
+
+	/**
+         * @brief Exchanges the contents of two stacks in O(1).
+         * @param other The stack to swap with.
+         */
+	void swap(StackWithArraySTL& other) noexcept { arr.swap(other.arr); }
+
 private:
 	/**
          * The dynamic array used to internally implement the stack.
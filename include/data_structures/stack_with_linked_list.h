@@ -1,6 +1,11 @@
 #ifndef DATA_STRUCTURES_STACK_WITH_LINKED_LIST_H
 #define DATA_STRUCTURES_STACK_WITH_LINKED_LIST_H
 
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
 #include "doubly_linked_list.h"
 
 namespace DataStructures {
@@ -41,6 +46,105 @@ public:
          */
 	size_t size() const { return list.get_size(); }
 
+	/**
+         * @brief Pop the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (list.is_empty()) {
+			return false;
+		}
+		out = list.del_last();
+		return true;
+	}
+
+	/**
+         * @brief Get the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (list.is_empty()) {
+			return false;
+		}
+		out = list.get_last();
+		return true;
+	}
+
+	/**
+         * @brief Pushes the elements of a range in order, so that the last
+         *        one ends up at the top of the stack.
+         *
+         * The new nodes are linked into a chain hooked onto the top in one
+         * step. If copying an element throws, the stack is left unchanged.
+         *
+         * @param first Input iterator to the first element to push.
+         * @param last Input iterator past the last element to push.
+         */
+	template <typename InputIt>
+	void push_n(InputIt first, InputIt last)
+	{
+		list.append(first, last);
+	}
+
+	/**
+         * @brief Pops @p count elements, writing them from the top down.
+         *
+         * The elements are moved out walking down from the top, then their
+         * nodes are freed and the rest of the list is relinked once.
+         *
+         * @param out Output iterator receiving the popped elements.
+         * @param count The number of elements to pop.
+         * @return The output iterator past the last written element.
+         * @throws std::out_of_range if the stack has fewer elements, in
+         *         which case nothing is popped.
+         */
+	template <typename OutputIt>
+	OutputIt pop_n(OutputIt out, size_t count)
+	{
+		if (count > list.get_size()) {
+			throw std::out_of_range(
+				"Stack has fewer elements than requested");
+		}
+		auto it = list.end();
+		for (size_t i = 0; i < count; i++) {
+			*out++ = std::move(*--it);
+		}
+		list.del_last_n(count);
+		return out;
+	}
+
+	/**
+         * @brief Get the values of the top @p count elements.
+         * @param count The number of elements.
+         * @return The values from the top of the stack down.
+         * @throws std::out_of_range if the stack has fewer elements.
+         */
+	std::vector<T> peek_n(size_t count) const
+	{
+		if (count > list.get_size()) {
+			throw std::out_of_range(
+				"Stack has fewer elements than requested");
+		}
+		std::vector<T> top;
+		top.reserve(count);
+		auto it = list.end();
+		for (size_t i = 0; i < count; i++) {
+			top.push_back(*--it);
+		}
+		return top;
+	}
+
+	/**
+         * @brief Exchanges the contents of two stacks in O(1).
+         * @param other The stack to swap with.
+         */
+	void swap(StackWithLinkedList& other) noexcept
+	{
+		list.swap(other.list);
+	}
+
 private:
 	/** 
          * The doubly linked list used for internally implementing the stack.
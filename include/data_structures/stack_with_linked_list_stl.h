@@ -1,7 +1,12 @@
 #ifndef DATA_STRUCTURES_STACK_WITH_LINKED_LIST_STL_H
 #define DATA_STRUCTURES_STACK_WITH_LINKED_LIST_STL_H
 
+#include <cstddef>
+#include <iterator>
 #include <list>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 namespace DataStructures {
 
@@ -42,6 +47,110 @@ public:
          */
 	size_t size() const { return list.size(); }
 
+	/**
+         * @brief Pop the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (list.empty()) {
+			return false;
+		}
+		out = std::move(list.back());
+		list.pop_back();
+		return true;
+	}
+
+	/**
+         * @brief Get the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (list.empty()) {
+			return false;
+		}
+		out = list.back();
+		return true;
+	}
+
+	/**
+         * @brief Pushes the elements of a range in order, so that the last
+         *        one ends up at the top of the stack.
+         *
+         * The elements are copied into a chain first, which is then spliced
+         * onto the top in one step. If copying an element throws, the stack
+         * is left unchanged.
+         *
+         * @param first Input iterator to the first element to push.
+         * @param last Input iterator past the last element to push.
+         */
+	template <typename InputIt>
+	void push_n(InputIt first, InputIt last)
+	{
+		std::list<T> chain(first, last);
+		list.splice(list.end(), chain);
+	}
+
+	/**
+         * @brief Pops @p count elements, writing them from the top down.
+         *
+         * The top @p count nodes are spliced off in one step and freed once
+         * the elements have been written out.
+         *
+         * @param out Output iterator receiving the popped elements.
+         * @param count The number of elements to pop.
+         * @return The output iterator past the last written element.
+         * @throws std::out_of_range if the stack has fewer elements, in
+         *         which case nothing is popped.
+         */
+	template <typename OutputIt>
+	OutputIt pop_n(OutputIt out, size_t count)
+	{
+		if (count > list.size()) {
+			throw std::out_of_range(
+				"Stack has fewer elements than requested");
+		}
+		auto pos = list.end();
+		std::advance(pos, -std::ptrdiff_t(count));
+		std::list<T> top;
+		top.splice(top.begin(), list, pos, list.end());
+		for (auto it = top.rbegin(); it != top.rend(); ++it) {
+			*out++ = std::move(*it);
+		}
+		return out;
+	}
+
+	/**
+         * @brief Get the values of the top @p count elements.
+         * @param count The number of elements.
+         * @return The values from the top of the stack down.
+         * @throws std::out_of_range if the stack has fewer elements.
+         */
+	std::vector<T> peek_n(size_t count) const
+	{
+		if (count > list.size()) {
+			throw std::out_of_range(
+				"Stack has fewer elements than requested");
+		}
+		std::vector<T> top;
+		top.reserve(count);
+		auto it = list.rbegin();
+		for (size_t i = 0; i < count; i++, ++it) {
+			top.push_back(*it);
+		}
+		return top;
+	}
+
+	/**
+         * @brief Exchanges the contents of two stacks in O(1).
+         * @param other The stack to swap with.
+         */
+	void swap(StackWithLinkedListSTL& other) noexcept
+	{
+		list.swap(other.list);
+	}
+
 private:
 	/** 
          * The doubly linked list used for internally implementing the stack.
@@ -0,0 +1,293 @@
+#ifndef DATA_STRUCTURES_STATIC_STACK_H
+#define DATA_STRUCTURES_STATIC_STACK_H
+
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+ * @class StaticStack
+ * @brief Stack keeping up to @p N elements inline, without any heap
+ *        allocation.
+ *
+ * The elements live in an array of raw storage inside the object, so a
+ * stack declared as a local variable lives entirely on the call stack, and
+ * the elements need not be default constructible. Pushing onto a full
+ * stack throws, unless @p Spill is set: further elements then go to a heap
+ * vector, which is drained before the inline elements again, so the inline
+ * elements never move. The vector keeps its capacity until the stack is
+ * cleared.
+ *
+ * Moving a stack moves its inline elements one by one, so unlike the other
+ * stacks it takes O(n) time.
+ *
+ * @tparam T Type of the elements.
+ * @tparam N Number of elements stored inline.
+ * @tparam Spill Whether to spill to the heap instead of throwing when the
+ *         inline storage is full.
+ */
+template <typename T, size_t N, bool Spill = false>
+class StaticStack {
+	static_assert(N > 0, "StaticStack needs room for at least one element");
+
+public:
+	/**
+         * @brief Constructor for an empty StaticStack.
+         */
+	StaticStack() noexcept : count(0) {}
+
+	/**
+         * @brief Copy constructor, copying every element.
+         * @param other The stack to copy.
+         */
+	StaticStack(const StaticStack& other) : StaticStack()
+	{
+		for (size_t i = 0; i < other.count; i++) {
+			new (slot(i)) T(*other.slot(i));
+			count++;
+		}
+		overflow = other.overflow;
+	}
+
+	/**
+         * @brief Move constructor, moving every element and leaving
+         *        @p other empty.
+         * @param other The stack to move from.
+         */
+	StaticStack(StaticStack&& other) : StaticStack()
+	{
+		for (size_t i = 0; i < other.count; i++) {
+			new (slot(i)) T(std::move(*other.slot(i)));
+			count++;
+		}
+		overflow = std::move(other.overflow);
+		other.clear();
+	}
+
+	/**
+         * @brief Copy assignment, replacing the elements by copies of those
+         *        of another stack.
+         * @param other The stack to copy.
+         * @return Reference to this stack.
+         */
+	StaticStack& operator=(const StaticStack& other)
+	{
+		if (this != &other) {
+			clear();
+			for (size_t i = 0; i < other.count; i++) {
+				new (slot(i)) T(*other.slot(i));
+				count++;
+			}
+			overflow = other.overflow;
+		}
+		return *this;
+	}
+
+	/**
+         * @brief Move assignment, replacing the elements by those of another
+         *        stack, which is left empty.
+         * @param other The stack to move from.
+         * @return Reference to this stack.
+         */
+	StaticStack& operator=(StaticStack&& other)
+	{
+		if (this != &other) {
+			clear();
+			for (size_t i = 0; i < other.count; i++) {
+				new (slot(i)) T(std::move(*other.slot(i)));
+				count++;
+			}
+			overflow = std::move(other.overflow);
+			other.clear();
+		}
+		return *this;
+	}
+
+	/**
+         * @brief Destructor for the StaticStack class, destroying the
+         *        elements.
+         */
+	~StaticStack() { destroy_inline(); }
+
+	/**
+         * @brief Push the element at the top of the stack.
+         * @param element The element to be pushed.
+         * @throws std::length_error if the inline storage is full and
+         *         spilling is disabled.
+         */
+	void push(const T& element)
+	{
+		if (count < N) {
+			new (slot(count)) T(element);
+			count++;
+		} else {
+			spill(element, SpillTag());
+		}
+	}
+
+	/**
+         * @brief Pop the element from the top of the stack and return its
+         *        value.
+         * @return The value of the element that has been popped.
+         * @throws std::out_of_range if the stack is empty.
+         */
+	T pop()
+	{
+		if (is_spilled()) {
+			return unspill(SpillTag());
+		}
+		if (count == 0) {
+			throw std::out_of_range("Stack is empty");
+		}
+		T* top = slot(count - 1);
+		T element(std::move(*top));
+		top->~T();
+		count--;
+		return element;
+	}
+
+	/**
+         * @brief Get the value of the element at the top of the stack.
+         * @return The value of the element at the top of the stack.
+         * @throws std::out_of_range if the stack is empty.
+         */
+	T peek() const
+	{
+		if (is_spilled()) {
+			return spilled_top(SpillTag());
+		}
+		if (count == 0) {
+			throw std::out_of_range("Stack is empty");
+		}
+		return *slot(count - 1);
+	}
+
+	/**
+         * @brief Pop the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_pop(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = pop();
+		return true;
+	}
+
+	/**
+         * @brief Get the top element into @p out if there is one.
+         * @return false if the stack was empty.
+         */
+	bool try_peek(T& out) const
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = peek();
+		return true;
+	}
+
+	/**
+         * @brief Get the current size of the stack.
+         * @return The current size of the stack.
+         */
+	size_t size() const
+	{
+		return count == N ? N + overflow.size() : count;
+	}
+
+	/**
+         * @brief Check if the stack is empty.
+         * @return true if the stack has no elements, false otherwise.
+         */
+	bool is_empty() const { return count == 0; }
+
+	/**
+         * @brief Get the number of elements stored inline.
+         * @return The inline capacity @p N.
+         */
+	static constexpr size_t capacity() { return N; }
+
+	/**
+         * @brief Removes every element, freeing any spilled storage.
+         */
+	void clear()
+	{
+		destroy_inline();
+		overflow = Overflow();
+	}
+
+private:
+	/** @brief Stand-in for the heap vector when spilling is disabled. */
+	struct NoOverflow {
+		bool empty() const { return true; }
+		size_t size() const { return 0; }
+	};
+
+	typedef std::integral_constant<bool, Spill> SpillTag;
+	typedef typename std::conditional<Spill, std::vector<T>,
+					  NoOverflow>::type Overflow;
+	typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type Slot;
+
+	/** Raw storage of the inline elements, the first @ref count in use. */
+	Slot slots[N];
+	/** Number of inline elements. */
+	size_t count;
+	/** Elements pushed while the inline storage was full. */
+	Overflow overflow;
+
+	T* slot(size_t i) { return reinterpret_cast<T*>(&slots[i]); }
+
+	const T* slot(size_t i) const
+	{
+		return reinterpret_cast<const T*>(&slots[i]);
+	}
+
+	/**
+         * @brief Check if the top is on the heap. The inline storage is
+         *        full then, which is tested first as it is cheaper.
+         */
+	bool is_spilled() const { return count == N && !overflow.empty(); }
+
+	/** @brief Destroys the inline elements, from the top down. */
+	void destroy_inline()
+	{
+		while (count > 0) {
+			count--;
+			slot(count)->~T();
+		}
+	}
+
+	void spill(const T& element, std::true_type)
+	{
+		overflow.push_back(element);
+	}
+
+	void spill(const T&, std::false_type)
+	{
+		throw std::length_error("StaticStack is full");
+	}
+
+	T unspill(std::true_type)
+	{
+		T element(std::move(overflow.back()));
+		overflow.pop_back();
+		return element;
+	}
+
+	T spilled_top(std::true_type) const { return overflow.back(); }
+
+	// Never called, NoOverflow is always empty.
+	T unspill(std::false_type) { return *slot(0); }
+	T spilled_top(std::false_type) const { return *slot(0); }
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_STATIC_STACK_H
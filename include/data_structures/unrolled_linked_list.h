@@ -0,0 +1,696 @@
+#ifndef DATA_STRUCTURES_UNROLLED_LINKED_LIST_H
+#define DATA_STRUCTURES_UNROLLED_LINKED_LIST_H
+
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace DataStructures {
+
+/**
+ * @class UnrolledLinkedList
+ * @brief Doubly linked list of small arrays with all related functionality.
+ *
+ * Every node holds up to @p B elements next to each other, so walking the
+ * list takes one pointer hop per @p B elements and sequential traversal
+ * touches memory almost as densely as an array. Positional access counts
+ * whole nodes off from the nearer end before indexing into one.
+ *
+ * Inserting into a full node splits it into two half full ones. When a
+ * removal leaves a node less than half full, it takes an element from its
+ * successor, or merges with it if both fit into one node. Every node but
+ * the last is thus at least half full.
+ *
+ * @tparam T Type of the implementation class.
+ * @tparam B Maximum number of elements per node, at least two.
+ */
+template <typename T, size_t B = 16>
+class UnrolledLinkedList {
+	static_assert(B >= 2, "A node needs room for at least two elements");
+
+	template <bool IsConst>
+	class Iterator;
+
+public:
+	typedef Iterator<false> iterator;
+	typedef Iterator<true> const_iterator;
+
+	/**
+         * @brief Constructor for an empty UnrolledLinkedList.
+         */
+	UnrolledLinkedList() : head(nullptr), tail(nullptr), size(0) {}
+
+	/**
+         * @brief Destructor for the UnrolledLinkedList class.
+         *
+         * Destroys every element and frees every node.
+         */
+	~UnrolledLinkedList()
+	{
+		Node* p = head;
+		while (p != nullptr) {
+			Node* next = p->next;
+			p->destroy_all();
+			delete p;
+			p = next;
+		}
+	}
+
+	UnrolledLinkedList(const UnrolledLinkedList&) = delete;
+	UnrolledLinkedList& operator=(const UnrolledLinkedList&) = delete;
+
+	/**
+         * @brief Move constructor, taking over the nodes of another list in
+         *        O(1) and leaving it empty.
+         * @param other The list to move from.
+         */
+	UnrolledLinkedList(UnrolledLinkedList&& other) noexcept
+		: UnrolledLinkedList()
+	{
+		swap(other);
+	}
+
+	/**
+         * @brief Move assignment, freeing the current nodes and taking over
+         *        those of another list in O(1).
+         * @param other The list to move from, left empty.
+         * @return Reference to this list.
+         */
+	UnrolledLinkedList& operator=(UnrolledLinkedList&& other) noexcept
+	{
+		UnrolledLinkedList old(std::move(other));
+		swap(old);
+		return *this;
+	}
+
+	/* Add functions */
+	/**
+         * @brief Adds an element at the start of the list.
+         *
+         * If the first node is full, a new node is linked before it instead
+         * of splitting it, so a list built from the front stays densely
+         * packed.
+         *
+         * @param data The element to be added.
+         */
+	void add_first(const T& data)
+	{
+		if (head == nullptr || head->count == B) {
+			link_before(head, new_node_with(data));
+		} else {
+			head->insert(0, data);
+		}
+		size++;
+	}
+
+	/**
+         * @brief Adds an element at the end of the list.
+         *
+         * If the last node is full, a new node is linked after it instead of
+         * splitting it, so a list built from the back stays densely packed.
+         *
+         * @param data The element to be added.
+         */
+	void add_last(const T& data)
+	{
+		if (tail == nullptr || tail->count == B) {
+			link_after(tail, new_node_with(data));
+		} else {
+			tail->insert(tail->count, data);
+		}
+		size++;
+	}
+
+	/**
+         * @brief Adds an element at a valid position index.
+         *
+         * The node holding the element currently at @p pos_index is found
+         * and the element is inserted in front of it, after splitting the
+         * node in two if it is full.
+         *
+         * @param pos_index Position index at which the element is to be
+         *                  added.
+         * @param data The element to be added.
+         * @throws std::out_of_range if @p pos_index is not in [0, size].
+         */
+	void add(int pos_index, const T& data)
+	{
+		check_position_index(pos_index);
+		if (pos_index == int(size)) {
+			add_last(data);
+			return;
+		}
+		size_t offset;
+		Node* x = locate(size_t(pos_index), offset);
+		if (x->count == B) {
+			split(x);
+			if (offset > x->count) {
+				offset -= x->count;
+				x = x->next;
+			}
+		}
+		x->insert(offset, data);
+		size++;
+	}
+
+	/* Erase functions */
+	/**
+         * @brief Deletes the first element in the list.
+         * @return The deleted element.
+         * @throws std::out_of_range if the list is empty. The exception
+         *         message states that there are "No nodes to remove".
+         */
+	T del_first()
+	{
+		// Tests the end node itself: size == 0 does not tell the
+		// optimizer that the node is non-null.
+		if (head == nullptr) {
+			throw std::out_of_range("No nodes to remove");
+		}
+		return remove(head, 0);
+	}
+
+	/**
+         * @brief Deletes the last element in the list.
+         * @return The deleted element.
+         * @throws std::out_of_range if the list is empty. The exception
+         *         message states that there are "No nodes to remove".
+         */
+	T del_last()
+	{
+		if (tail == nullptr) {
+			throw std::out_of_range("No nodes to remove");
+		}
+		return remove(tail, tail->count - 1);
+	}
+
+	/**
+         * @brief Delete the first element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_first(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_first();
+		return true;
+	}
+
+	/**
+         * @brief Delete the last element into @p out if there is one.
+         * @return false if the list was empty.
+         */
+	bool try_del_last(T& out)
+	{
+		if (is_empty()) {
+			return false;
+		}
+		out = del_last();
+		return true;
+	}
+
+	/**
+         * @brief Deletes the element at a particular index.
+         * @param index Index of the element.
+         * @return The deleted element.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	T del(int index)
+	{
+		check_element_index(index);
+		size_t offset;
+		Node* x = locate(size_t(index), offset);
+		return remove(x, offset);
+	}
+
+	/* Get functions */
+	/**
+         * @brief Get the first element.
+         * @return The first element.
+         * @throws std::out_of_range when the list is empty. The exception
+         *         message states that there are "No nodes in the list".
+         */
+	T get_first() const
+	{
+		check_not_empty("No nodes in the list");
+		return head->at(0);
+	}
+
+	/**
+         * @brief Get the last element.
+         * @return The last element.
+         * @throws std::out_of_range when the list is empty. The exception
+         *         message states that there are "No nodes in the list".
+         */
+	T get_last() const
+	{
+		check_not_empty("No nodes in the list");
+		return tail->at(tail->count - 1);
+	}
+
+	/**
+         * @brief Get the element at a particular index.
+         * @param index Index of the element.
+         * @return The requested element.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	T get(int index) const
+	{
+		check_element_index(index);
+		size_t offset;
+		Node* x = locate(size_t(index), offset);
+		return x->at(offset);
+	}
+
+	/* Set function */
+	/**
+         * @brief Set the element at a particular index.
+         * @param index Index of the element.
+         * @param data Value to be set to.
+         * @return The old element.
+         * @throws std::out_of_range if @p index is not in [0, size).
+         */
+	T set(int index, const T& data)
+	{
+		check_element_index(index);
+		size_t offset;
+		Node* x = locate(size_t(index), offset);
+		T old = x->at(offset);
+		x->at(offset) = data;
+		return old;
+	}
+
+	/* Iterators */
+	/** @brief Iterator to the first element. */
+	iterator begin() { return iterator(head, 0); }
+
+	/** @brief Iterator past the last element. */
+	iterator end() { return iterator(nullptr, 0); }
+
+	/** @brief Const iterator to the first element. */
+	const_iterator begin() const { return const_iterator(head, 0); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator end() const { return const_iterator(nullptr, 0); }
+
+	/** @brief Const iterator to the first element. */
+	const_iterator cbegin() const { return begin(); }
+
+	/** @brief Const iterator past the last element. */
+	const_iterator cend() const { return end(); }
+
+	/* Utility functions */
+	/**
+         * @brief Exchanges the elements of two lists in O(1).
+         * @param other The list to swap with.
+         */
+	void swap(UnrolledLinkedList& other) noexcept
+	{
+		std::swap(head, other.head);
+		std::swap(tail, other.tail);
+		std::swap(size, other.size);
+	}
+
+	/**
+         * @brief Get the current size of the list.
+         * @return Current number of elements.
+         */
+	size_t get_size() const { return size; }
+
+	/**
+         * @brief Check if the list is empty.
+         * @return true if the list contains no elements, false otherwise.
+         */
+	bool is_empty() const { return size == 0; }
+
+	/**
+         * @brief Get the number of nodes.
+         * @return The current number of nodes.
+         */
+	size_t node_count() const
+	{
+		size_t n = 0;
+		for (Node* p = head; p != nullptr; p = p->next) {
+			n++;
+		}
+		return n;
+	}
+
+	/**
+         * @brief Display the elements, one bracketed group per node.
+         */
+	void display() const
+	{
+		std::cout << "Size = " << size << '\n';
+		for (Node* p = head; p != nullptr; p = p->next) {
+			std::cout << '[';
+			for (size_t i = 0; i < p->count; i++) {
+				std::cout << (i > 0 ? " " : "") << p->at(i);
+			}
+			std::cout << "]->";
+		}
+		std::cout << "nullptr" << '\n';
+		std::cout << '\n';
+	}
+
+private:
+	/**
+         * @brief Struct representing a node holding up to @p B elements.
+         *
+         * Elements are constructed in place in raw storage, so only the
+         * first @ref count slots hold live objects.
+         */
+	struct Node {
+		/** Raw storage for the elements. */
+		alignas(T) unsigned char storage[B * sizeof(T)];
+		/** Number of live elements, at the front of the storage. */
+		size_t count;
+		/** Pointer to the previous node. */
+		Node* prev;
+		/** Pointer to the next node. */
+		Node* next;
+
+		Node() : count(0), prev(nullptr), next(nullptr) {}
+
+		T* slot(size_t i) { return reinterpret_cast<T*>(storage) + i; }
+
+		T& at(size_t i) { return *slot(i); }
+
+		/**
+                 * @brief Inserts an element at offset @p i, moving the
+                 *        ones after it up by one. The node must not be
+                 *        full.
+                 */
+		void insert(size_t i, const T& data)
+		{
+			if (i == count) {
+				new (slot(count)) T(data);
+			} else {
+				T copy(data);
+				new (slot(count)) T(std::move(at(count - 1)));
+				for (size_t j = count - 1; j > i; j--) {
+					at(j) = std::move(at(j - 1));
+				}
+				at(i) = std::move(copy);
+			}
+			count++;
+		}
+
+		/**
+                 * @brief Removes the element at offset @p i, moving the
+                 *        ones after it down by one.
+                 */
+		T erase(size_t i)
+		{
+			T data = std::move(at(i));
+			for (size_t j = i; j + 1 < count; j++) {
+				at(j) = std::move(at(j + 1));
+			}
+			count--;
+			slot(count)->~T();
+			return data;
+		}
+
+		/**
+                 * @brief Moves the elements from offset @p from on to the
+                 *        end of @p other.
+                 */
+		void move_tail_to(size_t from, Node* other)
+		{
+			for (size_t j = from; j < count; j++) {
+				new (other->slot(other->count++))
+					T(std::move(at(j)));
+				slot(j)->~T();
+			}
+			count = from;
+		}
+
+		void destroy_all()
+		{
+			for (size_t j = 0; j < count; j++) {
+				slot(j)->~T();
+			}
+			count = 0;
+		}
+	};
+
+	/** First node, nullptr when empty. */
+	Node* head;
+	/** Last node, nullptr when empty. */
+	Node* tail;
+	/** Current number of elements. */
+	size_t size;
+
+	/**
+         * @brief Find the node holding the element at an index.
+         *
+         * Whole nodes are skipped from whichever end of the list is closer.
+         *
+         * @param index A valid element index.
+         * @param offset Receives the offset of the element in its node.
+         * @return The node holding the element.
+         */
+	Node* locate(size_t index, size_t& offset) const
+	{
+		if (index < size / 2) {
+			Node* p = head;
+			while (index >= p->count) {
+				index -= p->count;
+				p = p->next;
+			}
+			offset = index;
+			return p;
+		}
+		size_t from_back = size - 1 - index;
+		Node* p = tail;
+		while (from_back >= p->count) {
+			from_back -= p->count;
+			p = p->prev;
+		}
+		offset = p->count - 1 - from_back;
+		return p;
+	}
+
+	/**
+         * @brief Removes the element at @p offset in node @p x and restores
+         *        the minimum fill of the node.
+         */
+	T remove(Node* x, size_t offset)
+	{
+		T data = x->erase(offset);
+		size--;
+		rebalance(x);
+		return data;
+	}
+
+	/**
+         * @brief Refills a node that dropped below half full.
+         *
+         * An empty node is unlinked. Otherwise the node is merged with its
+         * successor if both fit into one node, or takes the first element
+         * of its successor. The last node has no successor and is instead
+         * merged into its predecessor when they fit together.
+         */
+	void rebalance(Node* x)
+	{
+		if (x->count == 0) {
+			unlink(x);
+			return;
+		}
+		if (x->count >= B / 2) {
+			return;
+		}
+		Node* next = x->next;
+		if (next != nullptr) {
+			if (x->count + next->count <= B) {
+				next->move_tail_to(0, x);
+				unlink(next);
+			} else {
+				new (x->slot(x->count++)) T(next->erase(0));
+			}
+		} else if (x->prev != nullptr &&
+			   x->prev->count + x->count <= B) {
+			x->move_tail_to(0, x->prev);
+			unlink(x);
+		}
+	}
+
+	/** @brief Moves the upper half of a full node into a new successor. */
+	void split(Node* x)
+	{
+		Node* y = new Node();
+		x->move_tail_to(x->count / 2, y);
+		link_after(x, y);
+	}
+
+	/** @brief Links @p x after @p p, or first if @p p is null. */
+	void link_after(Node* p, Node* x)
+	{
+		x->prev = p;
+		x->next = p != nullptr ? p->next : head;
+		if (x->next != nullptr) {
+			x->next->prev = x;
+		} else {
+			tail = x;
+		}
+		if (p != nullptr) {
+			p->next = x;
+		} else {
+			head = x;
+		}
+	}
+
+	/**
+         * @brief Allocates a node holding only @p data, freeing it again if
+         *        copying the element throws, so nothing is linked in then.
+         */
+	static Node* new_node_with(const T& data)
+	{
+		Node* x = new Node();
+		try {
+			x->insert(0, data);
+		} catch (...) {
+			delete x;
+			throw;
+		}
+		return x;
+	}
+
+	/** @brief Links @p x before @p p, or last if @p p is null. */
+	void link_before(Node* p, Node* x)
+	{
+		link_after(p != nullptr ? p->prev : tail, x);
+	}
+
+	/** @brief Unlinks and frees an empty node. */
+	void unlink(Node* x)
+	{
+		if (x->prev != nullptr) {
+			x->prev->next = x->next;
+		} else {
+			head = x->next;
+		}
+		if (x->next != nullptr) {
+			x->next->prev = x->prev;
+		} else {
+			tail = x->prev;
+		}
+		delete x;
+	}
+
+	void check_not_empty(const char* message) const
+	{
+		if (is_empty()) {
+			throw std::out_of_range(message);
+		}
+	}
+
+	/**
+         * @brief Checks the given index and throws an exception if out of
+         *        range.
+         * @param index Index to be checked.
+         * @throws std::out_of_range if @p index is not in [0, size). The
+         *         exception message includes the invalid index and the
+         *         current size of the list.
+         */
+	void check_element_index(int index) const
+	{
+		if (index < 0 || index >= int(size)) {
+			throw std::out_of_range(
+				"Index: " + std::to_string(index) +
+				", Size: " + std::to_string(size));
+		}
+	}
+
+	/**
+         * @brief Checks the given position index and throws an exception if
+         *        out of range.
+         * @param pos_index Position index to be checked.
+         * @throws std::out_of_range if @p pos_index is not in [0, size].
+         *         The exception message includes the invalid position index
+         *         and the current size of the list.
+         */
+	void check_position_index(int pos_index) const
+	{
+		if (pos_index < 0 || pos_index > int(size)) {
+			throw std::out_of_range(
+				"Index: " + std::to_string(pos_index) +
+				", Size: " + std::to_string(size));
+		}
+	}
+};
+
+/**
+ * @brief Forward iterator over an UnrolledLinkedList.
+ *
+ * Steps through the elements of a node by offset and only follows a link
+ * when the node is exhausted.
+ */
+template <typename T, size_t B>
+template <bool IsConst>
+class UnrolledLinkedList<T, B>::Iterator {
+public:
+	typedef std::forward_iterator_tag iterator_category;
+	typedef T value_type;
+	typedef std::ptrdiff_t difference_type;
+	typedef typename std::conditional<IsConst, const T*, T*>::type pointer;
+	typedef typename std::conditional<IsConst, const T&, T&>::type
+		reference;
+
+	Iterator() : node(nullptr), offset(0) {}
+
+	Iterator(Node* n, size_t pos) : node(n), offset(pos) {}
+
+	// Allows an iterator to be passed where a const_iterator is expected.
+	template <bool C = IsConst, typename = typename std::enable_if<C>::type>
+	Iterator(const Iterator<false>& other)
+		: node(other.node), offset(other.offset)
+	{
+	}
+
+	reference operator*() const { return node->at(offset); }
+
+	pointer operator->() const { return node->slot(offset); }
+
+	Iterator& operator++()
+	{
+		if (++offset == node->count) {
+			node = node->next;
+			offset = 0;
+		}
+		return *this;
+	}
+
+	Iterator operator++(int)
+	{
+		Iterator old = *this;
+		++*this;
+		return old;
+	}
+
+	bool operator==(const Iterator& other) const
+	{
+		return node == other.node && offset == other.offset;
+	}
+
+	bool operator!=(const Iterator& other) const
+	{
+		return !(*this == other);
+	}
+
+private:
+	friend class Iterator<!IsConst>;
+
+	Node* node;
+	size_t offset;
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_UNROLLED_LINKED_LIST_H
@@ -0,0 +1,242 @@
+#ifndef DATA_STRUCTURES_WORK_STEALING_DEQUE_H
+#define DATA_STRUCTURES_WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace DataStructures {
+
+/**
+ * @class WorkStealingDeque
+ * @brief Lock-free Chase-Lev work-stealing deque.
+ *
+ * One owner thread pushes and pops at the bottom in LIFO order while any
+ * number of thief threads steal from the top in FIFO order, which is the
+ * access pattern of a task scheduler: the owner works on its most recent,
+ * cache-hot tasks and idle threads take the oldest ones.
+ *
+ * The elements live in a growable circular array with a power of two
+ * capacity. Unlike @ref DequeWithArray the array never shrinks; when it is
+ * full the owner copies the live range into an array twice the size and
+ * publishes it. Thieves may still be reading the old array, so it is not
+ * freed but retired until the deque itself is destroyed. Since capacities
+ * double, the retired arrays together never exceed the size of the current
+ * one.
+ *
+ * The memory orderings follow Lê, Pop, Cohen and Zappa Nardelli, "Correct
+ * and Efficient Work-Stealing for Weak Memory Models" (PPoPP 2013).
+ *
+ * @tparam T Type of the elements, which must be trivially copyable, e.g. a
+ *           pointer to a task.
+ */
+template <typename T>
+class WorkStealingDeque {
+	static_assert(std::is_trivially_copyable<T>::value,
+		      "WorkStealingDeque requires a trivially copyable type");
+
+public:
+	/**
+         * @brief Constructor for the WorkStealingDeque class.
+         * @param init_capacity Initial capacity, rounded up to a power of two.
+         */
+	explicit WorkStealingDeque(size_t init_capacity = 64)
+		: top(0), bottom(0)
+	{
+		size_t cap = 1;
+		while (cap < init_capacity) {
+			cap *= 2;
+		}
+		array.store(new Array(cap), std::memory_order_relaxed);
+	}
+
+	/**
+         * @brief Destructor for the WorkStealingDeque class.
+         *
+         * Frees the current array and all retired ones. No thread may be
+         * using the deque anymore.
+         */
+	~WorkStealingDeque()
+	{
+		delete array.load(std::memory_order_relaxed);
+		for (Array* old : retired) {
+			delete old;
+		}
+	}
+
+	WorkStealingDeque(const WorkStealingDeque&) = delete;
+	WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+	/**
+         * @brief Pushes an element at the bottom. Owner thread only.
+         * @param element The element to be pushed.
+         */
+	void push(const T& element)
+	{
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_acquire);
+		Array* a = array.load(std::memory_order_relaxed);
+		if (b - t > int64_t(a->capacity()) - 1) {
+			a = grow(a, t, b);
+		}
+		a->put(b, element);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+	}
+
+	/**
+         * @brief Pops the element at the bottom. Owner thread only.
+         *
+         * When a single element is left, the owner races the thieves for it
+         * with a compare-and-swap on the top index.
+         *
+         * @param out Receives the popped element.
+         * @return true if an element was popped, false if the deque was
+         *         empty or the last element was stolen.
+         */
+	bool pop(T& out)
+	{
+		int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		Array* a = array.load(std::memory_order_relaxed);
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+		if (t > b) {
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+		out = a->get(b);
+		if (t < b) {
+			return true;
+		}
+		bool won = top.compare_exchange_strong(
+			t, t + 1, std::memory_order_seq_cst,
+			std::memory_order_relaxed);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return won;
+	}
+
+	/**
+         * @brief Steals the element at the top. Any thread.
+         *
+         * A steal fails not only when the deque is empty but also when it
+         * loses a race against another thief or the owner, in which case the
+         * caller may simply try again or move on to another victim.
+         *
+         * @param out Receives the stolen element.
+         * @return true if an element was stolen, false otherwise.
+         */
+	bool steal(T& out)
+	{
+		int64_t t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t b = bottom.load(std::memory_order_acquire);
+		if (t >= b) {
+			return false;
+		}
+		Array* a = array.load(std::memory_order_acquire);
+		T val = a->get(t);
+		if (!top.compare_exchange_strong(t, t + 1,
+						 std::memory_order_seq_cst,
+						 std::memory_order_relaxed)) {
+			return false;
+		}
+		out = val;
+		return true;
+	}
+
+	/**
+         * @brief Gets the number of elements in the deque.
+         *
+         * Only a snapshot when other threads are operating on the deque.
+         *
+         * @return The number of elements at the time of the call.
+         */
+	size_t size() const
+	{
+		int64_t b = bottom.load(std::memory_order_relaxed);
+		int64_t t = top.load(std::memory_order_relaxed);
+		return b > t ? size_t(b - t) : 0;
+	}
+
+	/**
+         * @brief Check if the deque is empty.
+         * @return true if the deque had no elements at the time of the call.
+         */
+	bool is_empty() const { return size() == 0; }
+
+	/**
+         * @brief Gets the capacity of the current array. Owner thread only.
+         * @return The capacity of the current array.
+         */
+	size_t capacity() const
+	{
+		return array.load(std::memory_order_relaxed)->capacity();
+	}
+
+private:
+	/** @brief Circular array of atomic slots with a power of two size. */
+	class Array {
+	public:
+		explicit Array(size_t cap)
+			: mask(cap - 1), slots(new std::atomic<T>[cap])
+		{
+		}
+
+		~Array() { delete[] slots; }
+
+		Array(const Array&) = delete;
+		Array& operator=(const Array&) = delete;
+
+		size_t capacity() const { return mask + 1; }
+
+		T get(int64_t i) const
+		{
+			return slots[size_t(i) & mask].load(
+				std::memory_order_relaxed);
+		}
+
+		void put(int64_t i, const T& val)
+		{
+			slots[size_t(i) & mask].store(
+				val, std::memory_order_relaxed);
+		}
+
+	private:
+		size_t mask;
+		std::atomic<T>* slots;
+	};
+
+	/** Index of the oldest element, advanced by thieves. */
+	alignas(64) std::atomic<int64_t> top;
+	/** Index one past the newest element, moved by the owner. */
+	alignas(64) std::atomic<int64_t> bottom;
+	/** The current array. */
+	alignas(64) std::atomic<Array*> array;
+	/** Arrays replaced by @ref grow(), freed on destruction. */
+	std::vector<Array*> retired;
+
+	/**
+         * @brief Replaces the array with one twice its size.
+         *
+         * Copies the live range [t, b) at the same logical indices, so
+         * concurrent thieves read the same values from either array.
+         *
+         * @return The new array.
+         */
+	Array* grow(Array* a, int64_t t, int64_t b)
+	{
+		Array* bigger = new Array(a->capacity() * 2);
+		for (int64_t i = t; i < b; i++) {
+			bigger->put(i, a->get(i));
+		}
+		retired.push_back(a);
+		array.store(bigger, std::memory_order_release);
+		return bigger;
+	}
+};
+
+} // namespace DataStructures
+
+#endif // DATA_STRUCTURES_WORK_STEALING_DEQUE_H
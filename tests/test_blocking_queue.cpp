@@ -0,0 +1,105 @@
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "data_structures/blocking_queue.h"
+
+void test_single_thread_behavior()
+{
+	DataStructures::BlockingQueue<int> q(2);
+	assert(q.capacity() == 2);
+	assert(q.push(1));
+	assert(q.push(2));
+	assert(q.size() == 2);
+	assert(!q.try_push_for(3, std::chrono::milliseconds(1)));
+	int v = 0;
+	assert(q.pop(v) && v == 1);
+	assert(q.try_pop_for(v, std::chrono::milliseconds(1)) && v == 2);
+	assert(!q.try_pop_for(v, std::chrono::milliseconds(1)));
+	bool caught = false;
+	try {
+		DataStructures::BlockingQueue<int> bad(0);
+	} catch (const std::invalid_argument&) {
+		caught = true;
+	}
+	assert(caught);
+}
+
+void test_close_drains_then_fails()
+{
+	DataStructures::BlockingQueue<int> q(4);
+	q.push(7);
+	q.close();
+	assert(q.is_closed());
+	assert(!q.push(8));
+	int v = 0;
+	assert(q.pop(v) && v == 7);
+	assert(!q.pop(v));
+	assert(!q.try_pop_for(v, std::chrono::seconds(10)));
+}
+
+void test_close_wakes_waiters()
+{
+	DataStructures::BlockingQueue<int> q(1);
+	std::vector<std::thread> waiters;
+	for (int i = 0; i < 4; i++) {
+		waiters.emplace_back([&q] {
+			int v;
+			assert(!q.pop(v));
+		});
+	}
+	std::this_thread::sleep_for(std::chrono::milliseconds(10));
+	q.close();
+	for (std::thread& t : waiters) {
+		t.join();
+	}
+}
+
+void test_producers_and_consumers()
+{
+	const int producers = 4, consumers = 4, per_producer = 10000;
+	DataStructures::BlockingQueue<int> q(8);
+	std::vector<long long> sums(consumers, 0);
+	std::vector<std::thread> threads;
+	for (int c = 0; c < consumers; c++) {
+		threads.emplace_back([&q, &sums, c] {
+			int v;
+			while (q.pop(v)) {
+				sums[size_t(c)] += v;
+			}
+		});
+	}
+	std::vector<std::thread> writers;
+	for (int p = 0; p < producers; p++) {
+		writers.emplace_back([&q] {
+			for (int i = 1; i <= per_producer; i++) {
+				assert(q.push(i));
+			}
+		});
+	}
+	for (std::thread& t : writers) {
+		t.join();
+	}
+	q.close();
+	for (std::thread& t : threads) {
+		t.join();
+	}
+	long long total = 0;
+	for (long long s : sums) {
+		total += s;
+	}
+	long long one = 1LL * per_producer * (per_producer + 1) / 2;
+	assert(total == producers * one);
+}
+
+int main()
+{
+	test_single_thread_behavior();
+	test_close_drains_then_fails();
+	test_close_wakes_waiters();
+	test_producers_and_consumers();
+	std::cout << "All BlockingQueue tests passed!\n";
+	return 0;
+}
@@ -1,7 +1,11 @@
+#include <algorithm>
 #include <cassert>
+#include <numeric>
 #include <stdexcept>
 #include <iostream>
+#include <utility>
 #include "data_structures/circular_array.h"
+#include "try_ops.h"
 
 void test_empty_array_behavior()
 {
@@ -72,11 +76,119 @@ void test_resizing_behavior()
 	assert(ca.get_last() == 3);
 }
 
+void test_random_access()
+{
+	DataStructures::CircularArray<int> ca(4);
+	ca.add_last(2);
+	ca.add_last(3);
+	ca.add_first(1);
+	ca.add_first(0); // wrapped: storage is [2, 3, 0, 1]
+	for (int i = 0; i < 4; i++) {
+		assert(ca.get(i) == i);
+		assert(ca[size_t(i)] == i);
+	}
+	ca[1] = 10;
+	assert(ca.get(1) == 10);
+	bool caught1 = false, caught2 = false;
+	try {
+		ca.get(4);
+	} catch (const std::out_of_range&) {
+		caught1 = true;
+	}
+	try {
+		ca.get(-1);
+	} catch (const std::out_of_range&) {
+		caught2 = true;
+	}
+	assert(caught1 && caught2);
+}
+
+void test_iterators()
+{
+	DataStructures::CircularArray<int> ca(4);
+	ca.add_last(3);
+	ca.add_last(4);
+	ca.add_first(2);
+	ca.add_first(1);
+	assert(ca.end() - ca.begin() == 4);
+	int expected = 1;
+	for (int x : ca) {
+		assert(x == expected++);
+	}
+	assert(std::accumulate(ca.cbegin(), ca.cend(), 0) == 10);
+	DataStructures::CircularArray<int>::iterator it = ca.begin();
+	assert(it[2] == 3);
+	it += 3;
+	assert(*it == 4);
+	--it;
+	assert(*it == 3);
+	assert(*(it - 2) == 1);
+	std::reverse(ca.begin(), ca.end());
+	assert(ca.get_first() == 4);
+	assert(ca.get_last() == 1);
+	std::sort(ca.begin(), ca.end());
+	assert(std::is_sorted(ca.cbegin(), ca.cend()));
+	const DataStructures::CircularArray<int>& cref = ca;
+	DataStructures::CircularArray<int>::const_iterator cit = ca.begin();
+	assert(cit == cref.begin());
+	assert(std::find(cref.begin(), cref.end(), 3) - cref.begin() == 2);
+}
+
+void test_segments()
+{
+	DataStructures::CircularArray<int> ca(8);
+	for (int i = 0; i < 5; i++) {
+		ca.add_last(i);
+	}
+	std::pair<DataStructures::Span<int>, DataStructures::Span<int>> segs =
+		ca.segments();
+	assert(segs.first.size() == 5);
+	assert(segs.second.empty());
+	for (int i = 0; i < 3; i++) {
+		ca.add_first(-1 - i);
+	}
+	// Storage is [0, 1, 2, 3, 4, -3, -2, -1] with the front at index 5.
+	segs = ca.segments();
+	assert(segs.first.size() == 3);
+	assert(segs.second.size() == 5);
+	assert(segs.first[0] == -3);
+	assert(segs.second[0] == 0);
+	std::vector<int> flat;
+	for (int x : segs.first) {
+		flat.push_back(x);
+	}
+	for (int x : segs.second) {
+		flat.push_back(x);
+	}
+	assert(std::equal(flat.begin(), flat.end(), ca.begin()));
+}
+
+void test_move_and_swap()
+{
+	DataStructures::CircularArray<int> a;
+	for (int i = 0; i < 10; i++) {
+		a.add_last(i);
+	}
+	DataStructures::CircularArray<int> b(std::move(a));
+	assert(a.get_size() == 0 && b.get_size() == 10);
+	a.add_first(42);
+	a.swap(b);
+	assert(a.get_size() == 10 && b.get_size() == 1);
+	assert(a.get(9) == 9 && b.get(0) == 42);
+	b = std::move(a);
+	assert(b.get_size() == 10 && b.get(0) == 0);
+}
+
 int main()
 {
 	test_empty_array_behavior();
 	test_basic_add_remove();
 	test_resizing_behavior();
+	test_random_access();
+	test_iterators();
+	test_segments();
+	test_move_and_swap();
+	check_try_del<DataStructures::CircularArray<int>>();
 	std::cout << "All CircularArray tests passed!\n";
 	return 0;
 }
@@ -0,0 +1,377 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "data_structures/compact_linked_list.h"
+#include "try_ops.h"
+
+void test_add_and_delete()
+{
+	DataStructures::CompactLinkedList<int> list;
+	assert(list.is_empty());
+	assert(list.get_capacity() == 0);
+	list.add_last(2);
+	list.add_first(1);
+	list.add_last(4);
+	list.add(2, 3);
+	assert(list.get_size() == 4);
+	for (int i = 0; i < 4; i++) {
+		assert(list.get(i) == i + 1);
+	}
+	assert(list.get_first() == 1 && list.get_last() == 4);
+	assert(list.set(1, 20) == 2);
+	assert(list.del_first() == 1);
+	assert(list.del_last() == 4);
+	assert(list.del(0) == 20);
+	assert(list.get_first() == 3 && list.get_last() == 3);
+	assert(list.del(0) == 3);
+	assert(list.is_empty());
+}
+
+void test_freed_nodes_are_reused()
+{
+	DataStructures::CompactLinkedList<int> list;
+	for (int i = 0; i < 64; i++) {
+		list.add_last(i);
+	}
+	size_t cap = list.get_capacity();
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < 32; i++) {
+			list.del_first();
+		}
+		for (int i = 0; i < 32; i++) {
+			list.add_last(i);
+		}
+	}
+	assert(list.get_size() == 64);
+	assert(list.get_capacity() == cap);
+	list.clear();
+	assert(list.is_empty() && list.get_capacity() == 0);
+	list.reserve(100);
+	assert(list.get_capacity() >= 100);
+	list.add_last(5);
+	assert(list.get_first() == 5);
+}
+
+void test_against_std_list()
+{
+	DataStructures::CompactLinkedList<int> list;
+	std::list<int> ref;
+	std::srand(11);
+	for (int step = 0; step < 5000; step++) {
+		int op = std::rand() % 4;
+		if (op < 2 || ref.empty()) {
+			size_t pos = size_t(std::rand()) % (ref.size() + 1);
+			list.add(int(pos), step);
+			std::list<int>::iterator it = ref.begin();
+			for (size_t i = 0; i < pos; i++) {
+				++it;
+			}
+			ref.insert(it, step);
+		} else {
+			size_t idx = size_t(std::rand()) % ref.size();
+			std::list<int>::iterator it = ref.begin();
+			for (size_t i = 0; i < idx; i++) {
+				++it;
+			}
+			int got = list.del(int(idx));
+			assert(got == *it);
+			ref.erase(it);
+		}
+	}
+	assert(list.get_size() == ref.size());
+	std::list<int>::iterator it = ref.begin();
+	for (int v : list) {
+		assert(v == *it++);
+	}
+	std::list<int>::reverse_iterator rit = ref.rbegin();
+	DataStructures::CompactLinkedList<int>::iterator last = list.end();
+	while (last != list.begin()) {
+		--last;
+		assert(*last == *rit++);
+	}
+}
+
+void test_iterators_survive_growth()
+{
+	DataStructures::CompactLinkedList<std::string> list;
+	list.add_last("a");
+	DataStructures::CompactLinkedList<std::string>::iterator it =
+		list.begin();
+	for (int i = 0; i < 100; i++) {
+		list.add_last("x");
+	}
+	assert(*it == "a");
+	*it = "b";
+	assert(list.get_first() == "b");
+	const DataStructures::CompactLinkedList<std::string>& c = list;
+	DataStructures::CompactLinkedList<std::string>::const_iterator ci =
+		it;
+	assert(ci == c.begin() && ci->size() == 1);
+}
+
+void test_erase_if_and_remove()
+{
+	DataStructures::CompactLinkedList<int> list;
+	for (int i = 0; i < 20; i++) {
+		list.add_last(i % 5);
+	}
+	assert(list.remove(0) == 4);
+	assert(list.erase_if([](int x) { return x % 2 == 1; }) == 8);
+	assert(list.get_size() == 8);
+	for (int v : list) {
+		assert(v == 2 || v == 4);
+	}
+	list.add_first(9);
+	assert(list.get_first() == 9);
+}
+
+void test_copy_move_and_swap()
+{
+	DataStructures::CompactLinkedList<int> a;
+	for (int i = 0; i < 10; i++) {
+		a.add_last(i);
+	}
+	a.del(3);
+	DataStructures::CompactLinkedList<int> b(a);
+	b.set(0, 100);
+	assert(a.get_first() == 0 && b.get_first() == 100);
+	b.add_last(10);
+	assert(b.get_size() == 10 && b.get(3) == 4);
+	DataStructures::CompactLinkedList<int> c(std::move(a));
+	assert(a.is_empty() && c.get_size() == 9);
+	a.add_last(1);
+	a.swap(c);
+	assert(a.get_size() == 9 && c.get_size() == 1);
+	c = a;
+	assert(c.get_size() == 9 && c.get_last() == 9);
+	c = std::move(b);
+	assert(c.get_size() == 10 && c.get_first() == 100);
+}
+
+void test_exceptions()
+{
+	DataStructures::CompactLinkedList<int> list;
+	bool thrown = false;
+	try {
+		list.del_first();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		list.get_last();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	list.add_last(1);
+	thrown = false;
+	try {
+		list.add(3, 2);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		list.get(1);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+}
+
+void test_cursor_edits()
+{
+	DataStructures::CompactLinkedList<int> list;
+	DataStructures::CompactLinkedList<int>::Cursor end = list.end_cursor();
+	assert(list.cursor().is_end());
+	end.insert_before(1);
+	end.insert_before(3);
+	DataStructures::CompactLinkedList<int>::Cursor c = list.cursor();
+	assert(c.get() == 1);
+	c.insert_after(2);
+	c.advance();
+	assert(c.get() == 2);
+	for (int i = 0; i < 100; i++) {
+		list.add_last(100 + i);
+	}
+	assert(c.get() == 2);
+	assert(c.erase() == 2 && c.get() == 3);
+	c.retreat();
+	c.insert_before(0);
+	assert(list.get(0) == 0 && list.get(1) == 1 && list.get(2) == 3);
+	end.retreat();
+	assert(end.get() == 199);
+	c = list.cursor();
+	bool thrown = false;
+	try {
+		c.retreat();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		list.end_cursor().get();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+}
+
+void test_sort_and_merge()
+{
+	std::vector<std::pair<int, int>> ref;
+	DataStructures::CompactLinkedList<std::pair<int, int>> list;
+	srand(7);
+	for (int i = 0; i < 1000; i++) {
+		std::pair<int, int> x(rand() % 50, i);
+		ref.push_back(x);
+		list.add_last(x);
+		if (i % 3 == 0) {
+			list.del_first();
+			ref.erase(ref.begin());
+		}
+	}
+	auto by_key = [](const std::pair<int, int>& a,
+			 const std::pair<int, int>& b) {
+		return a.first < b.first;
+	};
+	std::stable_sort(ref.begin(), ref.end(), by_key);
+	list.sort(by_key);
+	assert(list.get_size() == ref.size());
+	assert(std::equal(ref.begin(), ref.end(), list.begin()));
+	assert(list.get_last() == ref.back());
+	DataStructures::CompactLinkedList<int> a;
+	DataStructures::CompactLinkedList<int> b;
+	for (int i = 0; i < 10; i++) {
+		a.add_last(2 * i);
+		b.add_last(2 * i + 1);
+	}
+	a.merge(b);
+	assert(a.get_size() == 20 && b.is_empty());
+	for (int i = 0; i < 20; i++) {
+		assert(a.get(i) == i);
+	}
+	assert(a.get_last() == 19);
+	DataStructures::CompactLinkedList<int> empty;
+	b.add_last(5);
+	empty.merge(b);
+	assert(empty.get_size() == 1 && empty.get_first() == 5);
+}
+
+void test_append_and_split()
+{
+	DataStructures::CompactLinkedList<int> a;
+	DataStructures::CompactLinkedList<int> b;
+	std::vector<int> v = {0, 1, 2};
+	a.append(v.begin(), v.end());
+	for (int i = 3; i < 6; i++) {
+		b.add_last(i);
+	}
+	a.append(std::move(b));
+	assert(a.get_size() == 6 && b.is_empty());
+	for (int i = 0; i < 6; i++) {
+		assert(a.get(i) == i);
+	}
+	DataStructures::CompactLinkedList<int> c;
+	c.append(std::move(a));
+	assert(c.get_size() == 6 && a.is_empty());
+	DataStructures::CompactLinkedList<int>::Cursor mid = c.cursor();
+	for (int i = 0; i < 4; i++) {
+		mid.advance();
+	}
+	DataStructures::CompactLinkedList<int> rest = c.split_at(mid);
+	assert(c.get_size() == 4 && c.get_last() == 3);
+	assert(rest.get_size() == 2 && rest.get_first() == 4);
+	assert(rest.get_last() == 5);
+	rest = c.split_at(c.cursor());
+	assert(c.is_empty() && rest.get_size() == 4);
+	rest = rest.split_at(rest.end_cursor());
+	assert(rest.is_empty());
+
+	// Appending the list to itself grows the node array under the range.
+	DataStructures::CompactLinkedList<int> self;
+	for (int i = 0; i < 5; i++) {
+		self.add_last(i);
+	}
+	self.append(self.begin(), self.end());
+	assert(self.get_size() == 10);
+	for (int i = 0; i < 10; i++) {
+		assert(self.get(i) == i % 5);
+	}
+}
+
+struct Poison {
+	int v;
+
+	Poison(int x = 0) : v(x) {}
+
+	Poison(const Poison& other) = default;
+
+	Poison& operator=(const Poison& other)
+	{
+		if (other.v < 0) {
+			throw std::runtime_error("copy failed");
+		}
+		v = other.v;
+		return *this;
+	}
+};
+
+void test_failed_copy_frees_its_node()
+{
+	DataStructures::CompactLinkedList<Poison> list;
+	list.reserve(4);
+	for (int i = 0; i < 4; i++) {
+		list.add_last(Poison(i));
+	}
+	list.del_first();
+	bool thrown = false;
+	try {
+		list.add_last(Poison(-1));
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	assert(thrown && list.get_size() == 3);
+	list.add_last(Poison(4));
+	assert(list.get_capacity() == 4 && list.get_last().v == 4);
+	std::vector<Poison> in = {Poison(5), Poison(-1), Poison(6)};
+	thrown = false;
+	try {
+		list.append(in.begin(), in.end());
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	assert(thrown && list.get_size() == 4 && list.get_last().v == 4);
+	size_t cap = list.get_capacity();
+	list.add_last(Poison(7));
+	list.add_last(Poison(8));
+	assert(list.get_capacity() == cap && list.get_size() == 6);
+}
+
+int main()
+{
+	test_add_and_delete();
+	test_freed_nodes_are_reused();
+	test_against_std_list();
+	test_iterators_survive_growth();
+	test_erase_if_and_remove();
+	test_copy_move_and_swap();
+	test_exceptions();
+	check_try_del<DataStructures::CompactLinkedList<int>>();
+	test_cursor_edits();
+	test_sort_and_merge();
+	test_append_and_split();
+	test_failed_copy_frees_its_node();
+	std::cout << "All CompactLinkedList tests passed!\n";
+	return 0;
+}
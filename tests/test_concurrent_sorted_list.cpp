@@ -0,0 +1,112 @@
+#include <atomic>
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "data_structures/concurrent_sorted_list.h"
+
+void test_single_threaded()
+{
+	DataStructures::ConcurrentSortedList<std::string> list;
+	assert(list.is_empty());
+	assert(list.add("b"));
+	assert(list.add("a"));
+	assert(list.add("c"));
+	assert(!list.add("b"));
+	assert(list.get_size() == 3);
+	assert(list.contains("a") && list.contains("c"));
+	assert(!list.contains("d"));
+	std::string order;
+	list.for_each([&order](const std::string& s) { order += s; });
+	assert(order == "abc");
+	assert(list.remove("b"));
+	assert(!list.remove("b"));
+	assert(!list.remove("z"));
+	assert(!list.contains("b"));
+	assert(list.get_size() == 2);
+	assert(list.remove("a") && list.remove("c"));
+	assert(list.is_empty());
+}
+
+void test_custom_order()
+{
+	DataStructures::ConcurrentSortedList<int, std::greater<int>> list;
+	for (int i = 0; i < 10; i++) {
+		list.add(i);
+	}
+	std::vector<int> keys;
+	list.for_each([&keys](int k) { keys.push_back(k); });
+	for (size_t i = 0; i < keys.size(); i++) {
+		assert(keys[i] == int(9 - i));
+	}
+}
+
+/*
+ * Every thread owns the keys congruent to its index and adds and removes
+ * them in rounds, while all threads look up every key. A thread always
+ * knows whether its own keys are present, so every add and remove must
+ * succeed, and the final contents are exactly the keys left in.
+ */
+void test_concurrent_add_remove(int threads, int keys_per_thread)
+{
+	DataStructures::ConcurrentSortedList<int> list;
+	std::atomic<bool> failed(false);
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&, t] {
+			for (int round = 0; round < 20; round++) {
+				for (int i = 0; i < keys_per_thread; i++) {
+					int k = i * threads + t;
+					if (!list.add(k)) {
+						failed = true;
+					}
+					list.contains(k + 1);
+				}
+				for (int i = 0; i < keys_per_thread; i++) {
+					int k = i * threads + t;
+					if (i % 2 == round % 2 || round == 19) {
+						continue;
+					}
+					if (!list.remove(k)) {
+						failed = true;
+					}
+				}
+				for (int i = 0; i < keys_per_thread; i++) {
+					int k = i * threads + t;
+					bool kept = i % 2 == round % 2 ||
+						    round == 19;
+					if (list.contains(k) != kept) {
+						failed = true;
+					}
+					if (!kept) {
+						continue;
+					}
+					if (round < 19 && !list.remove(k)) {
+						failed = true;
+					}
+				}
+			}
+		});
+	}
+	for (std::thread& w : workers) {
+		w.join();
+	}
+	assert(!failed);
+	assert(list.get_size() == size_t(threads * keys_per_thread));
+	int expected = 0;
+	list.for_each([&expected](int k) { assert(k == expected++); });
+	assert(expected == threads * keys_per_thread);
+}
+
+int main()
+{
+	test_single_threaded();
+	test_custom_order();
+	test_concurrent_add_remove(4, 200);
+	test_concurrent_add_remove(8, 100);
+	std::cout << "All ConcurrentSortedList tests passed!\n";
+	return 0;
+}
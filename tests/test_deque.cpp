@@ -0,0 +1,102 @@
+#include <cassert>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include "data_structures/deque.h"
+#include "try_ops.h"
+
+template <typename Container>
+void test_both_ends()
+{
+	DataStructures::Deque<int, Container> deque;
+	assert(deque.is_empty());
+	for (int i = 0; i < 50; i++) {
+		deque.add_first(-i);
+		deque.add_last(i);
+	}
+	assert(deque.size() == 100);
+	assert(deque.peek_first() == -49);
+	assert(deque.peek_last() == 49);
+	for (int i = 49; i >= 0; i--) {
+		assert(deque.del_first() == -i);
+		assert(deque.del_last() == i);
+	}
+	assert(deque.is_empty());
+}
+
+template <typename Container>
+void test_empty_throws()
+{
+	DataStructures::Deque<int, Container> deque;
+	int thrown = 0;
+	try {
+		deque.del_first();
+	} catch (const std::out_of_range&) {
+		thrown++;
+	}
+	try {
+		deque.del_last();
+	} catch (const std::out_of_range&) {
+		thrown++;
+	}
+	try {
+		deque.peek_first();
+	} catch (const std::out_of_range&) {
+		thrown++;
+	}
+	try {
+		deque.peek_last();
+	} catch (const std::out_of_range&) {
+		thrown++;
+	}
+	assert(thrown == 4);
+}
+
+template <typename Container>
+void test_backend()
+{
+	test_both_ends<Container>();
+	test_empty_throws<Container>();
+	check_try_del_and_peek<DataStructures::Deque<int, Container>>();
+}
+
+void test_string_deque()
+{
+	DataStructures::Deque<std::string> deque;
+	deque.add_last("B");
+	deque.add_first("A");
+	deque.add_last("C");
+	assert(deque.del_first() == "A");
+	assert(deque.del_last() == "C");
+	assert(deque.peek_first() == "B");
+	assert(deque.size() == 1);
+}
+
+void test_swap()
+{
+	DataStructures::Deque<int> a;
+	DataStructures::Deque<int> b;
+	a.add_last(1);
+	a.add_last(2);
+	b.add_last(3);
+	a.swap(b);
+	assert(a.size() == 1 && a.peek_first() == 3);
+	assert(b.size() == 2 && b.peek_first() == 1 && b.peek_last() == 2);
+}
+
+int main()
+{
+	using namespace DataStructures;
+	test_backend<CircularArray<int>>();
+	test_backend<DoublyLinkedList<int>>();
+	test_backend<CompactLinkedList<int>>();
+	test_backend<UnrolledLinkedList<int>>();
+	test_backend<std::deque<int>>();
+	test_backend<std::list<int>>();
+	test_string_deque();
+	test_swap();
+	std::cout << "All Deque tests passed." << '\n';
+	return 0;
+}
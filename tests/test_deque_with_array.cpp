@@ -1,7 +1,9 @@
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <stdexcept>
 #include "data_structures/deque_with_array.h"
+#include "try_ops.h"
 
 void test_empty_deque_behavior()
 {
@@ -71,12 +73,39 @@ void test_mixed_operations()
 	assert(dq.peek_last() == "end");
 }
 
+void test_random_access_and_iteration()
+{
+	DataStructures::DequeWithArray<int> dq;
+	dq.add_last(2);
+	dq.add_last(3);
+	dq.add_first(1);
+	dq.add_first(0);
+	assert(dq.size() == 4);
+	for (int i = 0; i < 4; i++) {
+		assert(dq.get(i) == i);
+		assert(dq[size_t(i)] == i);
+	}
+	int expected = 0;
+	for (int x : dq) {
+		assert(x == expected++);
+	}
+	std::reverse(dq.begin(), dq.end());
+	assert(dq.peek_first() == 3);
+	assert(dq.peek_last() == 0);
+	std::pair<DataStructures::Span<int>, DataStructures::Span<int>> segs =
+		dq.segments();
+	assert(segs.first.size() + segs.second.size() == dq.size());
+	assert(segs.first[0] == 3);
+}
+
 int main()
 {
 	test_empty_deque_behavior();
 	test_add_peek_operations();
 	test_delete_operations();
 	test_mixed_operations();
+	test_random_access_and_iteration();
+	check_try_del_and_peek<DataStructures::DequeWithArray<int>>();
 	std::cout << "All DequeWithArray tests passed!\n";
 	return 0;
 }
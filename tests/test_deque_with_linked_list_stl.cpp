@@ -2,6 +2,7 @@
 #include <iostream>
 #include <stdexcept>
 #include "data_structures/deque_with_linked_list_stl.h"
+#include "try_ops.h"
 
 void test_empty_deque_behavior()
 {
@@ -77,6 +78,7 @@ int main()
 	test_add_peek_operations();
 	test_delete_operations();
 	test_mixed_operations();
+	check_try_del_and_peek<DataStructures::DequeWithLinkedListSTL<int>>();
 	std::cout << "All DequeWithLinkedListSTL tests passed!\n";
 	return 0;
 }
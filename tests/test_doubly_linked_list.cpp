@@ -1,7 +1,14 @@
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 #include "data_structures/doubly_linked_list.h"
+#include "try_ops.h"
 
 void test_initially_empty()
 {
@@ -147,6 +154,444 @@ void test_clear_list()
 	assert(list.get_size() == 0);
 }
 
+void test_clear_method()
+{
+	DataStructures::DoublyLinkedList<int> list;
+	list.clear();
+	for (int i = 0; i < 1000; ++i)
+		list.add_last(i);
+	assert(list.get_pool()->slabs_allocated() > 0);
+	list.clear();
+	assert(list.get_size() == 0);
+	assert(list.get_pool()->slabs_allocated() == 0);
+	list.add_first(2);
+	list.add_first(1);
+	list.add_last(3);
+	assert(list.get(0) == 1 && list.get(1) == 2 && list.get(2) == 3);
+}
+
+void test_shared_pool_reuses_nodes()
+{
+	DataStructures::DoublyLinkedList<int> a;
+	DataStructures::DoublyLinkedList<int> b(a.get_pool());
+	for (int i = 0; i < 100; ++i)
+		a.add_last(i);
+	size_t reserved = a.get_pool()->blocks_reserved();
+	while (!a.is_empty())
+		b.add_last(a.del_first());
+	assert(b.get_size() == 100 && b.get_last() == 99);
+	assert(a.get_pool()->blocks_reserved() == reserved);
+}
+
+void test_iterators()
+{
+	DataStructures::DoublyLinkedList<int> list;
+	assert(list.begin() == list.end());
+	for (int i = 0; i < 5; ++i)
+		list.add_last(i);
+	int expected = 0;
+	for (int& v : list) {
+		assert(v == expected++);
+		v *= 10;
+	}
+	DataStructures::DoublyLinkedList<int>::iterator it = list.end();
+	--it;
+	assert(*it == 40);
+	--it;
+	assert(*it == 30);
+	const DataStructures::DoublyLinkedList<int>& ref = list;
+	DataStructures::DoublyLinkedList<int>::const_iterator cit = ref.begin();
+	assert(*cit == 0);
+}
+
+void test_cursor_edits()
+{
+	DataStructures::DoublyLinkedList<int> list;
+	for (int i = 1; i <= 6; ++i)
+		list.add_last(i);
+	DataStructures::DoublyLinkedList<int>::Cursor c = list.cursor();
+	while (!c.is_end()) {
+		if (c.get() % 2 == 1) {
+			c.erase();
+		} else {
+			c.insert_before(-c.get());
+			c.insert_after(0);
+			c.advance();
+			c.advance();
+		}
+	}
+	c.insert_before(99);
+	c.retreat();
+	assert(c.get() == 99);
+	c.retreat();
+	assert(c.get() == 0);
+	int expected[] = {-2, 2, 0, -4, 4, 0, -6, 6, 0, 99};
+	assert(list.get_size() == 10);
+	for (int i = 0; i < 10; ++i)
+		assert(list.get(i) == expected[i]);
+	DataStructures::DoublyLinkedList<int>::Cursor first = list.cursor();
+	bool got = false;
+	try {
+		first.retreat();
+	} catch (std::out_of_range&) {
+		got = true;
+	}
+	assert(got);
+}
+
+void test_erase_if_and_remove()
+{
+	DataStructures::DoublyLinkedList<int> list;
+	for (int i = 0; i < 20; ++i)
+		list.add_last(i % 5);
+	assert(list.remove(4) == 4);
+	assert(list.erase_if([](int x) { return x < 2; }) == 8);
+	assert(list.get_size() == 8);
+	for (int v : list)
+		assert(v == 2 || v == 3);
+	assert(list.get_first() == 2 && list.get_last() == 3);
+}
+
+void test_append_and_splice()
+{
+	DataStructures::DoublyLinkedList<int> a;
+	DataStructures::DoublyLinkedList<int> b;
+	for (int i = 0; i < 3; ++i)
+		a.add_last(i);
+	for (int i = 3; i < 6; ++i)
+		b.add_last(i);
+	a.append(std::move(b));
+	assert(a.get_size() == 6 && b.is_empty());
+	for (int i = 0; i < 6; ++i)
+		assert(a.get(i) == i);
+	b.add_last(100);
+	DataStructures::DoublyLinkedList<int>::Cursor pos = a.cursor();
+	pos.advance();
+	a.splice(pos, b);
+	assert(a.get_size() == 7 && b.is_empty() && a.get(1) == 100);
+	assert(pos.get() == 1);
+	b.add_last(-1);
+	b.add_last(-2);
+	a.splice(a.cursor(), b);
+	assert(a.get_first() == -1 && a.get(1) == -2 && a.get(2) == 0);
+	DataStructures::DoublyLinkedList<int> moved(std::move(a));
+	assert(moved.get_size() == 9 && a.is_empty());
+	assert(moved.get_last() == 5);
+}
+
+void test_range_splice_and_split()
+{
+	DataStructures::DoublyLinkedList<int> a;
+	DataStructures::DoublyLinkedList<int> b;
+	for (int i = 0; i < 10; ++i)
+		a.add_last(i);
+	DataStructures::DoublyLinkedList<int>::Cursor first = a.cursor();
+	first.advance();
+	first.advance();
+	DataStructures::DoublyLinkedList<int>::Cursor last = first;
+	for (int i = 0; i < 3; ++i)
+		last.advance();
+	b.splice(b.end_cursor(), a, first, last);
+	assert(b.get_size() == 3 && a.get_size() == 7);
+	assert(b.get_first() == 2 && b.get_last() == 4);
+	assert(a.get(1) == 1 && a.get(2) == 5);
+	first = a.cursor();
+	last = a.cursor();
+	last.advance();
+	b.splice(b.cursor(), a, first, last, 1);
+	assert(b.get_first() == 0 && b.get_size() == 4);
+	assert(a.get_first() == 1 && a.get_last() == 9);
+	DataStructures::DoublyLinkedList<int>::Cursor mid = a.cursor();
+	for (int i = 0; i < 3; ++i)
+		mid.advance();
+	DataStructures::DoublyLinkedList<int> rest = a.split_at(mid);
+	assert(a.get_size() == 3 && a.get_last() == 6);
+	assert(rest.get_size() == 3 && rest.get_first() == 7);
+	assert(rest.get_last() == 9 && rest.get_pool() == a.get_pool());
+	rest.add_last(10);
+	assert(rest.get_last() == 10 && a.get_last() == 6);
+	DataStructures::DoublyLinkedList<int> none = a.split_at(a.end_cursor());
+	assert(none.is_empty() && a.get_size() == 3);
+}
+
+void test_splice_between_pools()
+{
+	DataStructures::DoublyLinkedList<int> a;
+	DataStructures::DoublyLinkedList<int> b;
+	a.add_last(1);
+	b.add_last(2);
+	assert(a.get_pool() != b.get_pool());
+	a.splice(a.end_cursor(), b);
+	assert(a.get_pool() == b.get_pool());
+	assert(a.get_pool()->blocks_in_use() == 2);
+	DataStructures::DoublyLinkedList<int> c(a.get_pool());
+	DataStructures::DoublyLinkedList<int> d;
+	DataStructures::DoublyLinkedList<int> e(d.get_pool());
+	d.add_last(3);
+	a.splice(a.end_cursor(), d);
+	assert(d.is_empty() && a.get_size() == 3 && a.get_last() == 3);
+	assert(a.get_pool() != d.get_pool());
+	while (!a.is_empty())
+		a.del_first();
+	assert(a.get_pool()->blocks_in_use() == 0);
+}
+
+void test_splice_keeps_outside_cursors()
+{
+	typedef DataStructures::DoublyLinkedList<int>::Cursor Cursor;
+	DataStructures::DoublyLinkedList<int> a;
+	DataStructures::DoublyLinkedList<int> b(a.get_pool());
+	for (int i = 0; i < 3; ++i)
+		a.add_last(i);
+	for (int i = 10; i < 15; ++i)
+		b.add_last(i);
+	Cursor first = b.cursor();
+	first.advance();
+	Cursor last = first;
+	last.advance();
+	last.advance();
+	Cursor pos = a.end_cursor();
+	a.splice(pos, b, first, last, 2);
+	assert(a.get_size() == 5 && b.get_size() == 3);
+	assert(pos.is_end());
+	pos.insert_before(3);
+	assert(a.get_size() == 6 && a.get_last() == 3);
+	assert(last.get() == 13);
+	last.insert_before(12);
+	assert(b.get_size() == 4 && b.get(1) == 12 && b.get(2) == 13);
+	DataStructures::DoublyLinkedList<int> c;
+	DataStructures::DoublyLinkedList<int> d(c.get_pool());
+	DataStructures::DoublyLinkedList<int> e;
+	DataStructures::DoublyLinkedList<int> f(e.get_pool());
+	e.add_last(20);
+	e.add_last(21);
+	e.add_last(22);
+	c.add_last(0);
+	first = e.cursor();
+	last = first;
+	last.advance();
+	pos = c.cursor();
+	c.splice(pos, e, first, last, 1);
+	assert(c.get_size() == 2 && c.get_first() == 20 && e.get_size() == 2);
+	assert(pos.get() == 0 && last.get() == 21);
+	last.erase();
+	assert(e.get_size() == 1 && e.get_first() == 22);
+	assert(d.is_empty() && f.is_empty());
+}
+
+typedef std::pair<int, int> Record;
+
+bool by_key(const Record& a, const Record& b) { return a.first < b.first; }
+
+void test_sort_is_stable()
+{
+	DataStructures::DoublyLinkedList<Record> list;
+	std::vector<Record> ref;
+	std::srand(5);
+	for (int i = 0; i < 1000; i++) {
+		Record r(std::rand() % 50, i);
+		list.add_last(r);
+		ref.push_back(r);
+	}
+	size_t reserved = list.get_pool()->blocks_reserved();
+	list.sort(by_key);
+	std::stable_sort(ref.begin(), ref.end(), by_key);
+	assert(list.get_size() == 1000);
+	assert(list.get_pool()->blocks_reserved() == reserved);
+	size_t k = 0;
+	for (const Record& r : list)
+		assert(r == ref[k++]);
+	assert(list.get_last() == ref.back());
+	list.add_last(Record(-1, 0));
+	list.sort(by_key);
+	assert(list.get_first().first == -1 && list.get_last() == ref.back());
+	DataStructures::DoublyLinkedList<int> empty;
+	empty.sort();
+	assert(empty.is_empty());
+}
+
+void test_merge_sorted_lists()
+{
+	DataStructures::DoublyLinkedList<int> a;
+	DataStructures::DoublyLinkedList<int> b;
+	DataStructures::DoublyLinkedList<int> c(b.get_pool());
+	for (int i = 0; i < 10; i++) {
+		a.add_last(3 * i);
+		b.add_last(2 * i);
+	}
+	a.merge(b);
+	assert(b.is_empty() && a.get_size() == 20);
+	assert(a.get_last() == 27);
+	int prev = -1;
+	for (int v : a) {
+		assert(v >= prev);
+		prev = v;
+	}
+	c.add_last(100);
+	a.merge(c);
+	assert(a.get_last() == 100 && c.is_empty());
+	a.add_last(200);
+	assert(a.get_size() == 22 && a.get_last() == 200);
+
+	DataStructures::DoublyLinkedList<int> d;
+	d.add_last(5);
+	DataStructures::DoublyLinkedList<int> lists[5];
+	std::vector<DataStructures::DoublyLinkedList<int>*> others;
+	for (int j = 0; j < 5; j++) {
+		for (int i = 0; i < 4; i++)
+			lists[j].add_last(j + 5 * i);
+		others.push_back(&lists[j]);
+	}
+	d.merge(others);
+	assert(d.get_size() == 21);
+	int expected[] = {0, 1, 2, 3, 4, 5, 5, 6};
+	for (int i = 0; i < 8; i++)
+		assert(d.get(i) == expected[i]);
+	assert(d.get_last() == 19);
+	for (int j = 0; j < 5; j++)
+		assert(lists[j].is_empty());
+	DataStructures::DoublyLinkedList<int> e;
+	d.sort(std::greater<int>());
+	e.add_last(10);
+	e.merge(d, std::greater<int>());
+	assert(e.get_size() == 22 && e.get_first() == 19);
+	assert(e.get(9) == 10 && e.get(10) == 10 && e.get_last() == 0);
+}
+
+struct NoDefault {
+	int v;
+	explicit NoDefault(int x) : v(x) {}
+};
+
+void test_move_and_swap()
+{
+	DataStructures::DoublyLinkedList<int> a;
+	assert(a.begin() == a.end());
+	for (int i = 0; i < 5; i++) {
+		a.add_last(i);
+	}
+	DataStructures::DoublyLinkedList<int> b(std::move(a));
+	assert(a.is_empty() && a.begin() == a.end());
+	assert(b.get_size() == 5 && b.get_last() == 4);
+	a.add_last(9);
+	a.swap(b);
+	assert(a.get_size() == 5 && b.get_size() == 1);
+	assert(a.get_first() == 0 && b.get_first() == 9);
+	b.add_last(10);
+	assert(b.get_last() == 10);
+	b = std::move(a);
+	assert(a.is_empty() && b.get_size() == 5);
+	int k = 0;
+	for (int v : b) {
+		assert(v == k++);
+	}
+	DataStructures::DoublyLinkedList<int> empty;
+	empty.swap(b);
+	assert(b.is_empty() && empty.get_size() == 5);
+	b.add_first(1);
+	assert(b.get_first() == 1 && b.get_last() == 1);
+
+	DataStructures::DoublyLinkedList<NoDefault> nd;
+	nd.add_last(NoDefault(3));
+	assert(nd.get_first().v == 3);
+}
+
+void test_compact_and_freeze()
+{
+	typedef DataStructures::DoublyLinkedList<std::string> List;
+	List list;
+	List other(list.get_pool());
+	for (int i = 0; i < 300; i++) {
+		list.add(i % 7 == 0 ? 0 : int(list.get_size()) / 2,
+			 std::to_string(i));
+		other.add_last(std::to_string(i));
+	}
+	list.erase_if([](const std::string& s) { return s.size() == 2; });
+	std::vector<std::string> before = list.freeze();
+	assert(before.size() == list.get_size());
+	list.compact();
+	assert(list.get_pool() != other.get_pool());
+	assert(list.get_pool()->slabs_allocated() == 1);
+	assert(list.freeze() == before);
+	const std::string* prev = nullptr;
+	for (const std::string& s : list) {
+		assert(prev == nullptr || &s > prev);
+		prev = &s;
+	}
+	list.add_last("x");
+	assert(list.get_last() == "x" && list.get_first() == before[0]);
+	assert(other.get_size() == 300 && other.get(299) == "299");
+
+	List empty;
+	empty.compact();
+	assert(empty.is_empty() && empty.freeze().empty());
+}
+
+/** Element type whose copy throws once a shared countdown runs out. */
+struct CopyBomb {
+	static int fuse;
+	int v;
+
+	CopyBomb(int x) : v(x) {}
+
+	CopyBomb(const CopyBomb& other) : v(other.v)
+	{
+		if (fuse-- == 0) {
+			throw std::runtime_error("copy failed");
+		}
+	}
+
+	CopyBomb& operator=(const CopyBomb&) = default;
+};
+
+int CopyBomb::fuse = -1;
+
+void test_append_range_and_del_last_n()
+{
+	DataStructures::DoublyLinkedList<int> list;
+	list.add_last(0);
+	std::vector<int> in = {1, 2, 3, 4};
+	list.append(in.begin(), in.end());
+	assert(list.get_size() == 5);
+	assert((list.freeze() == std::vector<int>{0, 1, 2, 3, 4}));
+	list.append(list.begin(), list.end());
+	assert((list.freeze() ==
+		std::vector<int>{0, 1, 2, 3, 4, 0, 1, 2, 3, 4}));
+	assert(list.get_size() == 10);
+	list.del_last_n(5);
+	list.append(in.end(), in.end());
+	assert(list.get_size() == 5 && list.get_last() == 4);
+	list.del_last_n(3);
+	assert((list.freeze() == std::vector<int>{0, 1}));
+	list.add_last(5);
+	assert(list.get_last() == 5);
+	bool thrown = false;
+	try {
+		list.del_last_n(4);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown && list.get_size() == 3);
+	list.del_last_n(3);
+	assert(list.is_empty());
+
+	DataStructures::DoublyLinkedList<CopyBomb> bombs;
+	bombs.add_last(CopyBomb(0));
+	std::vector<CopyBomb> more(4, CopyBomb(1));
+	CopyBomb::fuse = 2;
+	thrown = false;
+	try {
+		bombs.append(more.begin(), more.end());
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	CopyBomb::fuse = -1;
+	assert(thrown && bombs.get_size() == 1);
+	assert(bombs.get_last().v == 0 && bombs.get_first().v == 0);
+	bombs.add_last(CopyBomb(2));
+	assert(bombs.get_size() == 2 && bombs.get_last().v == 2);
+}
+
 int main()
 {
 	try {
@@ -162,6 +607,21 @@ int main()
 		test_invalid_index_throws();
 		test_throw_on_empty_delete();
 		test_clear_list();
+		test_clear_method();
+		test_shared_pool_reuses_nodes();
+		test_iterators();
+		test_cursor_edits();
+		test_erase_if_and_remove();
+		test_append_and_splice();
+		test_splice_keeps_outside_cursors();
+		test_range_splice_and_split();
+		test_splice_between_pools();
+		test_sort_is_stable();
+		test_merge_sorted_lists();
+		test_move_and_swap();
+		test_compact_and_freeze();
+		check_try_del<DataStructures::DoublyLinkedList<int>>();
+		test_append_range_and_del_last_n();
 		std::cout << "All DoublyLinkedList tests passed.\n";
 		return 0;
 	} catch (...) {
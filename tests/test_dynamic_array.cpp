@@ -1,7 +1,10 @@
 #include <cassert>
 #include <string>
 #include <iostream>
+#include <utility>
+#include <vector>
 #include "data_structures/dynamic_array.h"
+#include "try_ops.h"
 
 void test_add_and_get()
 {
@@ -75,6 +78,82 @@ void test_exceptions()
 	assert(caught);
 }
 
+void test_copy_move_and_swap()
+{
+	DataStructures::DynamicArray<std::string> a;
+	assert(a.get_size() == 0);
+	a.add_last("x");
+	a.add_last("y");
+	DataStructures::DynamicArray<std::string> b(a);
+	b.set(0, "z");
+	assert(a.get(0) == "x" && b.get(0) == "z");
+	DataStructures::DynamicArray<std::string> c(std::move(a));
+	assert(a.get_size() == 0 && c.get_size() == 2);
+	a.add_last("w");
+	a.swap(b);
+	assert(a.get_size() == 2 && b.get_size() == 1);
+	c = b;
+	assert(c.get_size() == 1 && c.get(0) == "w");
+	c = std::move(a);
+	assert(c.get_size() == 2 && c.get(0) == "z");
+}
+
+void test_append_reserve_and_del_last_n()
+{
+	DataStructures::DynamicArray<int> arr;
+	arr.reserve(100);
+	assert(arr.get_capacity() == 100 && arr.get_size() == 0);
+	std::vector<int> v(150);
+	for (int i = 0; i < 150; i++) {
+		v[size_t(i)] = i;
+	}
+	arr.append(v.begin(), v.end());
+	assert(arr.get_size() == 150 && arr.get_capacity() == 150);
+	assert(arr[0] == 0 && arr[149] == 149);
+	arr.del_last_n(140);
+	assert(arr.get_size() == 10 && arr[9] == 9);
+	assert(arr.get_capacity() >= 10 && arr.get_capacity() < 40);
+	bool thrown = false;
+	try {
+		arr.del_last_n(11);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown && arr.get_size() == 10);
+	arr.del_last_n(10);
+	assert(arr.is_empty());
+}
+
+/*
+ * del_last_n must leave the capacity del_last would, including when the
+ * size ends exactly at a quarter of the capacity.
+ */
+void test_del_last_n_matches_del_last()
+{
+	DataStructures::DynamicArray<int> arr;
+	for (int i = 0; i < 16; i++) {
+		arr.add_last(i);
+	}
+	arr.del_last_n(12);
+	assert(arr.get_size() == 4 && arr.get_capacity() == 16);
+	arr.del_last_n(1);
+	assert(arr.get_size() == 3 && arr.get_capacity() == 8);
+	for (int n = 0; n <= 70; n++) {
+		for (int k = 0; k <= n; k++) {
+			DataStructures::DynamicArray<int> bulk;
+			for (int i = 0; i < n; i++) {
+				bulk.add_last(i);
+			}
+			DataStructures::DynamicArray<int> single(bulk);
+			bulk.del_last_n(size_t(k));
+			for (int i = 0; i < k; i++) {
+				single.del_last();
+			}
+			assert(bulk.get_capacity() == single.get_capacity());
+		}
+	}
+}
+
 int main()
 {
 	test_add_and_get();
@@ -83,6 +162,10 @@ int main()
 	test_deletion();
 	test_set();
 	test_exceptions();
+	test_copy_move_and_swap();
+	check_try_del<DataStructures::DynamicArray<int>>();
+	test_append_reserve_and_del_last_n();
+	test_del_last_n_matches_del_last();
 	std::cout << "All DynamicArray tests passed!\n";
 	return 0;
 }
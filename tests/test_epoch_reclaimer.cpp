@@ -0,0 +1,118 @@
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "data_structures/epoch_reclaimer.h"
+#include "data_structures/lock_free_queue.h"
+#include "data_structures/lock_free_stack.h"
+
+struct Tracked {
+	static std::atomic<int> live;
+	int value;
+
+	explicit Tracked(int v) : value(v) { live++; }
+	~Tracked() { live--; }
+};
+
+std::atomic<int> Tracked::live(0);
+
+void test_guarded_node_is_not_freed()
+{
+	std::atomic<Tracked*> shared(new Tracked(1));
+	DataStructures::EpochReclaimer::Guard* guard =
+		new DataStructures::EpochReclaimer::Guard();
+	Tracked* p = guard->protect(shared);
+	assert(p->value == 1);
+	// Another thread unlinks and retires the node inside the section.
+	std::thread remover([&shared] {
+		Tracked* old = shared.exchange(nullptr);
+		DataStructures::EpochReclaimer::retire(old);
+		for (int i = 0; i < 4; i++) {
+			DataStructures::EpochReclaimer::collect();
+		}
+	});
+	remover.join();
+	for (int i = 0; i < 4; i++) {
+		DataStructures::EpochReclaimer::collect();
+	}
+	assert(Tracked::live == 1);
+	assert(p->value == 1);
+	delete guard;
+	// The exited thread's leftovers are adopted by the next collect.
+	DataStructures::EpochReclaimer::collect();
+	DataStructures::EpochReclaimer::collect();
+	assert(Tracked::live == 0);
+}
+
+void test_retired_nodes_are_freed()
+{
+	for (int i = 0; i < 1000; i++) {
+		DataStructures::EpochReclaimer::retire(new Tracked(i));
+	}
+	assert(DataStructures::EpochReclaimer::pending() < 1000);
+	DataStructures::EpochReclaimer::collect();
+	DataStructures::EpochReclaimer::collect();
+	assert(DataStructures::EpochReclaimer::pending() == 0);
+	assert(Tracked::live == 0);
+}
+
+void test_guards_nest()
+{
+	DataStructures::EpochReclaimer::Guard outer;
+	{
+		DataStructures::EpochReclaimer::Guard inner;
+	}
+	// Still inside the outer section, so the node must survive.
+	DataStructures::EpochReclaimer::retire(new Tracked(2));
+	for (int i = 0; i < 4; i++) {
+		DataStructures::EpochReclaimer::collect();
+	}
+	assert(Tracked::live == 1);
+}
+
+void test_containers(int threads, int per_thread)
+{
+	DataStructures::LockFreeStack<int, DataStructures::EpochReclaimer>
+		stack;
+	DataStructures::LockFreeQueue<int, DataStructures::EpochReclaimer>
+		queue;
+	std::atomic<long> sum(0);
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&] {
+			int v;
+			for (int i = 0; i < per_thread; i++) {
+				stack.push(i);
+				queue.push(i);
+				while (!stack.pop(v)) {
+				}
+				sum += v;
+				while (!queue.pop(v)) {
+				}
+				sum -= v;
+			}
+		});
+	}
+	for (std::thread& w : workers) {
+		w.join();
+	}
+	assert(stack.is_empty());
+	assert(queue.is_empty());
+	// Every value was pushed once to each container and popped once.
+	assert(sum == 0);
+}
+
+int main()
+{
+	test_guarded_node_is_not_freed();
+	test_retired_nodes_are_freed();
+	test_guards_nest();
+	DataStructures::EpochReclaimer::collect();
+	DataStructures::EpochReclaimer::collect();
+	assert(Tracked::live == 0);
+	test_containers(1, 1000);
+	test_containers(8, 20000);
+	std::cout << "All EpochReclaimer tests passed!\n";
+	return 0;
+}
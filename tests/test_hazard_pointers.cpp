@@ -0,0 +1,73 @@
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include "data_structures/hazard_pointers.h"
+
+struct Tracked {
+	static std::atomic<int> live;
+	int value;
+
+	explicit Tracked(int v) : value(v) { live++; }
+	~Tracked() { live--; }
+};
+
+std::atomic<int> Tracked::live(0);
+
+void test_protected_node_is_not_freed()
+{
+	std::atomic<Tracked*> shared(new Tracked(1));
+	DataStructures::HazardPointers::Guard* guard =
+		new DataStructures::HazardPointers::Guard();
+	Tracked* p = guard->protect(shared);
+	assert(p->value == 1);
+	// Another thread unlinks and retires the node while it is protected.
+	std::thread remover([&shared] {
+		Tracked* old = shared.exchange(nullptr);
+		DataStructures::HazardPointers::retire(old);
+		DataStructures::HazardPointers::collect();
+	});
+	remover.join();
+	DataStructures::HazardPointers::collect();
+	assert(Tracked::live == 1);
+	assert(p->value == 1);
+	delete guard;
+	// The exited thread's leftovers are adopted by the next scan.
+	DataStructures::HazardPointers::collect();
+	assert(Tracked::live == 0);
+}
+
+void test_unprotected_nodes_are_freed()
+{
+	for (int i = 0; i < 1000; i++) {
+		DataStructures::HazardPointers::retire(new Tracked(i));
+	}
+	DataStructures::HazardPointers::collect();
+	assert(Tracked::live == 0);
+}
+
+void test_protect_follows_updates()
+{
+	std::atomic<Tracked*> shared(new Tracked(2));
+	DataStructures::HazardPointers::Guard guard;
+	assert(DataStructures::HazardPointers::slots_per_thread() >= 2);
+	Tracked* a = guard.protect(shared, 0);
+	Tracked* b = new Tracked(3);
+	shared.store(b);
+	assert(guard.protect(shared, 1) == b);
+	guard.clear(0);
+	DataStructures::HazardPointers::retire(a);
+	DataStructures::HazardPointers::collect();
+	assert(Tracked::live == 1);
+	shared.store(nullptr);
+	delete b;
+}
+
+int main()
+{
+	test_protected_node_is_not_freed();
+	test_unprotected_nodes_are_freed();
+	test_protect_follows_updates();
+	std::cout << "All HazardPointers tests passed!\n";
+	return 0;
+}
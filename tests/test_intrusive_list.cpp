@@ -0,0 +1,163 @@
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "data_structures/intrusive_list.h"
+
+struct Task {
+	std::string name;
+	int priority;
+	DataStructures::IntrusiveListHook run_hook;
+	DataStructures::IntrusiveListHook all_hook;
+
+	Task(const std::string& n, int p) : name(n), priority(p) {}
+};
+
+typedef DataStructures::IntrusiveList<Task, &Task::run_hook> RunList;
+typedef DataStructures::IntrusiveList<Task, &Task::all_hook> AllList;
+
+void test_add_and_delete()
+{
+	Task a("a", 1), b("b", 2), c("c", 3);
+	RunList list;
+	assert(list.is_empty());
+	list.add_last(b);
+	list.add_first(a);
+	list.add_last(c);
+	assert(list.get_size() == 3);
+	assert(&list.get_first() == &a);
+	assert(&list.get_last() == &c);
+	assert(&list.get(1) == &b);
+	assert(&list.del_first() == &a);
+	assert(!a.run_hook.is_linked());
+	assert(&list.del_last() == &c);
+	assert(&list.del(0) == &b);
+	assert(list.is_empty());
+}
+
+void test_add_at_index_and_insert_before()
+{
+	Task a("a", 1), b("b", 2), c("c", 3), d("d", 4);
+	RunList list;
+	list.add(0, a);
+	list.add(1, c);
+	list.add(1, b);
+	list.insert_before(a, d);
+	std::string order;
+	for (const Task& t : list) {
+		order += t.name;
+	}
+	assert(order == "dabc");
+	list.clear();
+}
+
+void test_remove_by_reference()
+{
+	std::vector<Task> tasks;
+	for (int i = 0; i < 10; i++) {
+		tasks.push_back(Task(std::to_string(i), i));
+	}
+	RunList list;
+	for (Task& t : tasks) {
+		list.add_last(t);
+	}
+	list.remove(tasks[4]);
+	list.remove(tasks[0]);
+	list.remove(tasks[9]);
+	assert(list.get_size() == 7);
+	assert(list.get_first().priority == 1);
+	assert(list.get_last().priority == 8);
+	RunList::iterator it = list.iterator_to(tasks[5]);
+	--it;
+	assert(it->priority == 3);
+	list.clear();
+	for (Task& t : tasks) {
+		assert(!t.run_hook.is_linked());
+	}
+}
+
+void test_multiple_lists_per_object()
+{
+	Task a("a", 1), b("b", 2);
+	RunList run;
+	AllList all;
+	all.add_last(a);
+	all.add_last(b);
+	run.add_last(b);
+	run.remove(b);
+	assert(run.is_empty());
+	assert(all.get_size() == 2 && &all.get_last() == &b);
+	all.clear();
+}
+
+void test_copies_are_not_linked()
+{
+	Task a("a", 1);
+	RunList list;
+	list.add_last(a);
+	Task copy(a);
+	assert(!copy.run_hook.is_linked());
+	copy = a;
+	assert(!copy.run_hook.is_linked());
+	list.add_last(copy);
+	assert(list.get_size() == 2);
+	list.clear();
+}
+
+void test_exceptions()
+{
+	Task a("a", 1);
+	RunList list;
+	bool got1 = false, got2 = false, got3 = false;
+	try {
+		list.del_first();
+	} catch (std::out_of_range&) {
+		got1 = true;
+	}
+	list.add_last(a);
+	try {
+		list.add_last(a);
+	} catch (std::invalid_argument&) {
+		got2 = true;
+	}
+	try {
+		list.get(1);
+	} catch (std::out_of_range&) {
+		got3 = true;
+	}
+	assert(got1 && got2 && got3);
+	list.clear();
+}
+
+void test_move_and_swap()
+{
+	Task a("a", 1), b("b", 2), c("c", 3);
+	RunList x;
+	x.add_last(a);
+	x.add_last(b);
+	RunList y(std::move(x));
+	assert(x.is_empty() && y.get_size() == 2);
+	x.add_last(c);
+	x.swap(y);
+	assert(x.get_size() == 2 && y.get_size() == 1);
+	assert(&x.get_last() == &b && &y.get_first() == &c);
+	y = std::move(x);
+	assert(x.is_empty() && y.get_size() == 2);
+	assert(!c.run_hook.is_linked());
+	assert(&y.del_last() == &b && &y.del_first() == &a);
+}
+
+int main()
+{
+	test_add_and_delete();
+	test_add_at_index_and_insert_before();
+	test_remove_by_reference();
+	test_multiple_lists_per_object();
+	test_copies_are_not_linked();
+	test_move_and_swap();
+	test_exceptions();
+	std::cout << "All IntrusiveList tests passed!\n";
+	return 0;
+}
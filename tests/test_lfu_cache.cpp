@@ -0,0 +1,160 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include "data_structures/lfu_cache.h"
+
+void test_evicts_least_frequently_used()
+{
+	DataStructures::LFUCache<int, std::string> cache(3);
+	cache.put(1, "one");
+	cache.put(2, "two");
+	cache.put(3, "three");
+	std::string v;
+	assert(cache.get(1, v) && v == "one");
+	assert(cache.get(1, v));
+	assert(cache.get(2, v));
+	assert(cache.use_count(1) == 3 && cache.use_count(2) == 2);
+	cache.put(4, "four");
+	assert(!cache.contains(3));
+	assert(cache.use_count(4) == 1);
+	cache.put(5, "five");
+	assert(!cache.contains(4) && cache.contains(5));
+	assert(cache.get(5, v) && cache.get(5, v));
+	cache.put(6, "six");
+	assert(!cache.contains(2));
+	assert(cache.get_stats().evictions == 3);
+	assert(cache.get_stats().hits == 5);
+}
+
+void test_ties_go_to_least_recently_used()
+{
+	DataStructures::LFUCache<int, int> cache(3);
+	cache.put(1, 1);
+	cache.put(2, 2);
+	cache.put(3, 3);
+	int v;
+	cache.get(2, v);
+	cache.get(1, v);
+	cache.get(3, v);
+	cache.put(4, 4);
+	assert(!cache.contains(2));
+	assert(cache.contains(1) && cache.contains(3) && cache.contains(4));
+}
+
+void test_update_counts_as_use()
+{
+	DataStructures::LFUCache<int, int> cache(2);
+	cache.put(1, 1);
+	cache.put(2, 2);
+	cache.put(1, 10);
+	cache.put(3, 3);
+	int v;
+	assert(cache.get(1, v) && v == 10);
+	assert(!cache.contains(2));
+	assert(cache.erase(3) && !cache.erase(3));
+	assert(cache.get_size() == 1);
+	cache.clear();
+	assert(cache.is_empty() && cache.use_count(1) == 0);
+}
+
+struct LengthWeigher {
+	size_t operator()(int, const std::string& s) const { return s.size(); }
+};
+
+void test_capacity_in_bytes()
+{
+	DataStructures::LFUCache<int, std::string, std::hash<int>,
+				 LengthWeigher>
+		cache(10);
+	std::string v;
+	cache.put(1, "aaaa");
+	cache.get(1, v);
+	cache.put(2, "bbbb");
+	cache.put(3, "cccc");
+	assert(!cache.contains(2) && cache.get_weight() == 8);
+	cache.put(1, "aaaaaaaa");
+	assert(cache.contains(1) && !cache.contains(3));
+	assert(cache.get_weight() == 8);
+	assert(!cache.put(4, "ddddddddddd"));
+	assert(cache.get_size() == 1);
+}
+
+/*
+ * Reference model: per key its value, use count and last use time; the
+ * victim is the minimum of (count, time).
+ */
+void test_against_model()
+{
+	struct Info {
+		int value;
+		unsigned long count;
+		long time;
+	};
+	const size_t cap = 50;
+	DataStructures::LFUCache<int, int> cache(cap);
+	std::map<int, Info> model;
+	std::srand(9);
+	for (long step = 0; step < 100000; step++) {
+		int key = std::rand() % 120;
+		int op = std::rand() % 5;
+		std::map<int, Info>::iterator it = model.find(key);
+		if (op == 0) {
+			bool erased = cache.erase(key);
+			assert(erased == (it != model.end()));
+			if (it != model.end()) {
+				model.erase(it);
+			}
+		} else if (op <= 2) {
+			int v = -1;
+			bool hit = cache.get(key, v);
+			assert(hit == (it != model.end()));
+			if (hit) {
+				assert(v == it->second.value);
+				it->second.count++;
+				it->second.time = step;
+			}
+		} else if (it != model.end()) {
+			cache.put(key, int(step));
+			it->second.value = int(step);
+			it->second.count++;
+			it->second.time = step;
+		} else {
+			if (model.size() == cap) {
+				std::map<int, Info>::iterator victim =
+					model.begin();
+				for (it = model.begin(); it != model.end();
+				     ++it) {
+					const Info& a = it->second;
+					const Info& b = victim->second;
+					if (a.count < b.count ||
+					    (a.count == b.count &&
+					     a.time < b.time)) {
+						victim = it;
+					}
+				}
+				model.erase(victim);
+			}
+			cache.put(key, int(step));
+			Info info = {int(step), 1, step};
+			model[key] = info;
+		}
+		assert(cache.get_size() == model.size());
+	}
+	for (const std::pair<const int, Info>& p : model) {
+		assert(cache.use_count(p.first) == p.second.count);
+	}
+}
+
+int main()
+{
+	test_evicts_least_frequently_used();
+	test_ties_go_to_least_recently_used();
+	test_update_counts_as_use();
+	test_capacity_in_bytes();
+	test_against_model();
+	std::cout << "All LFUCache tests passed!\n";
+	return 0;
+}
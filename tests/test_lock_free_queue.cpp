@@ -0,0 +1,115 @@
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "data_structures/lock_free_queue.h"
+
+void test_fifo_order()
+{
+	DataStructures::LockFreeQueue<std::string> q;
+	std::string v;
+	assert(q.is_empty());
+	assert(!q.pop(v));
+	q.push("A");
+	q.push("B");
+	assert(!q.is_empty());
+	assert(q.pop(v) && v == "A");
+	q.push("C");
+	assert(q.pop(v) && v == "B");
+	assert(q.pop(v) && v == "C");
+	assert(!q.pop(v));
+	assert(q.is_empty());
+}
+
+struct Tracked {
+	static std::atomic<int> live;
+	int value;
+
+	explicit Tracked(int v = 0) : value(v) { live++; }
+	Tracked(const Tracked& other) : value(other.value) { live++; }
+	Tracked& operator=(const Tracked&) = default;
+	~Tracked() { live--; }
+};
+
+std::atomic<int> Tracked::live(0);
+
+void test_elements_are_destroyed()
+{
+	{
+		DataStructures::LockFreeQueue<Tracked> q;
+		for (int i = 0; i < 100; i++) {
+			q.push(Tracked(i));
+		}
+		Tracked t;
+		for (int i = 0; i < 40; i++) {
+			assert(q.pop(t) && t.value == i);
+		}
+		assert(Tracked::live == 61);
+	}
+	// Only the popped-into local has gone out of scope; none leak.
+	assert(Tracked::live == 0);
+}
+
+/*
+ * Producers push (producer, sequence) pairs while consumers pop. In any
+ * linearizable FIFO a single consumer must see every producer's sequence
+ * numbers in increasing order, and every pair must be popped exactly once.
+ */
+void test_mpmc_linearizable(int producers, int consumers, int per_producer)
+{
+	DataStructures::LockFreeQueue<long> q;
+	std::vector<std::atomic<int>> seen(size_t(producers * per_producer));
+	for (std::atomic<int>& s : seen) {
+		s.store(0);
+	}
+	std::atomic<int> finished(0);
+	std::vector<std::thread> threads;
+	for (int c = 0; c < consumers; c++) {
+		threads.emplace_back([&] {
+			std::vector<long> last(size_t(producers), -1);
+			long v;
+			for (;;) {
+				bool done = finished.load() == producers;
+				if (!q.pop(v)) {
+					if (done) {
+						break;
+					}
+					continue;
+				}
+				long p = v / per_producer;
+				long seq = v % per_producer;
+				assert(seq > last[size_t(p)]);
+				last[size_t(p)] = seq;
+				seen[size_t(v)]++;
+			}
+		});
+	}
+	for (int p = 0; p < producers; p++) {
+		threads.emplace_back([&, p] {
+			for (int i = 0; i < per_producer; i++) {
+				q.push(long(p) * per_producer + i);
+			}
+			finished++;
+		});
+	}
+	for (std::thread& t : threads) {
+		t.join();
+	}
+	for (std::atomic<int>& s : seen) {
+		assert(s.load() == 1);
+	}
+	assert(q.is_empty());
+}
+
+int main()
+{
+	test_fifo_order();
+	test_elements_are_destroyed();
+	test_mpmc_linearizable(1, 1, 50000);
+	test_mpmc_linearizable(4, 4, 20000);
+	test_mpmc_linearizable(8, 2, 10000);
+	std::cout << "All LockFreeQueue tests passed!\n";
+	return 0;
+}
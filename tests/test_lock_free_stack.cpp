@@ -0,0 +1,83 @@
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "data_structures/lock_free_stack.h"
+
+void test_push_and_pop()
+{
+	DataStructures::LockFreeStack<std::string> stack;
+	std::string v;
+	assert(stack.is_empty());
+	assert(!stack.pop(v));
+	stack.push("A");
+	stack.push("B");
+	stack.push("C");
+	assert(!stack.is_empty());
+	assert(stack.pop(v) && v == "C");
+	assert(stack.pop(v) && v == "B");
+	stack.push("D");
+	assert(stack.pop(v) && v == "D");
+	assert(stack.pop(v) && v == "A");
+	assert(!stack.pop(v));
+}
+
+void test_destructor_frees_remaining_nodes()
+{
+	DataStructures::LockFreeStack<std::vector<int>> stack;
+	for (int i = 0; i < 100; i++) {
+		stack.push(std::vector<int>(10, i));
+	}
+}
+
+/*
+ * Threads push distinct values and pop as many as they pushed. Every value
+ * must come out exactly once across all threads.
+ */
+void test_concurrent_push_pop(int threads, int per_thread)
+{
+	DataStructures::LockFreeStack<int> stack;
+	std::vector<std::atomic<int>> seen(size_t(threads * per_thread));
+	for (std::atomic<int>& s : seen) {
+		s.store(0);
+	}
+	std::vector<std::thread> workers;
+	for (int t = 0; t < threads; t++) {
+		workers.emplace_back([&stack, &seen, t, per_thread] {
+			int v;
+			for (int i = 0; i < per_thread; i++) {
+				stack.push(t * per_thread + i);
+				if (i % 2 == 1) {
+					while (!stack.pop(v)) {
+					}
+					seen[size_t(v)]++;
+					while (!stack.pop(v)) {
+					}
+					seen[size_t(v)]++;
+				}
+			}
+		});
+	}
+	for (std::thread& w : workers) {
+		w.join();
+	}
+	int v;
+	while (stack.pop(v)) {
+		seen[size_t(v)]++;
+	}
+	for (std::atomic<int>& s : seen) {
+		assert(s.load() == 1);
+	}
+}
+
+int main()
+{
+	test_push_and_pop();
+	test_destructor_frees_remaining_nodes();
+	test_concurrent_push_pop(1, 1000);
+	test_concurrent_push_pop(8, 20000);
+	std::cout << "All LockFreeStack tests passed!\n";
+	return 0;
+}
@@ -0,0 +1,130 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include "data_structures/lru_cache.h"
+
+void test_evicts_least_recently_used()
+{
+	DataStructures::LRUCache<int, std::string> cache(3);
+	assert(cache.is_empty());
+	cache.put(1, "one");
+	cache.put(2, "two");
+	cache.put(3, "three");
+	std::string v;
+	assert(cache.get(1, v) && v == "one");
+	cache.put(4, "four");
+	assert(!cache.contains(2));
+	assert(cache.contains(1) && cache.contains(3) && cache.contains(4));
+	assert(cache.get_size() == 3);
+	cache.put(3, "THREE");
+	cache.put(5, "five");
+	assert(!cache.contains(1));
+	assert(cache.get(3, v) && v == "THREE");
+	assert(!cache.get(2, v));
+	const DataStructures::CacheStats& s = cache.get_stats();
+	assert(s.hits == 2 && s.misses == 1 && s.evictions == 2);
+	cache.reset_stats();
+	assert(cache.get_stats().hits == 0);
+}
+
+void test_erase_and_clear()
+{
+	DataStructures::LRUCache<std::string, int> cache(10);
+	for (int i = 0; i < 10; i++) {
+		cache.put(std::to_string(i), i);
+	}
+	assert(cache.erase("3"));
+	assert(!cache.erase("3"));
+	assert(cache.get_size() == 9);
+	int v = 0;
+	assert(cache.get("9", v) && v == 9);
+	cache.clear();
+	assert(cache.is_empty() && cache.get_weight() == 0);
+	cache.put("a", 1);
+	assert(cache.get("a", v) && v == 1);
+}
+
+struct LengthWeigher {
+	size_t operator()(int, const std::string& s) const { return s.size(); }
+};
+
+void test_capacity_in_bytes()
+{
+	DataStructures::LRUCache<int, std::string, std::hash<int>,
+				 LengthWeigher>
+		cache(10);
+	assert(cache.put(1, "aaaa"));
+	assert(cache.put(2, "bbbb"));
+	assert(cache.get_weight() == 8);
+	assert(cache.put(3, "cc"));
+	assert(cache.get_size() == 3 && cache.get_weight() == 10);
+	assert(cache.put(4, "d"));
+	assert(!cache.contains(1) && cache.get_weight() == 7);
+	assert(!cache.put(5, "eeeeeeeeeee"));
+	assert(!cache.contains(5));
+	assert(!cache.put(2, "bbbbbbbbbbbb"));
+	assert(!cache.contains(2) && cache.get_weight() == 3);
+	assert(cache.put(3, "cccccccccc"));
+	assert(!cache.contains(4) && cache.get_weight() == 10);
+}
+
+/*
+ * Reference model: std::list in recency order plus a map of iterators.
+ */
+void test_against_model()
+{
+	DataStructures::LRUCache<int, int> cache(100);
+	std::list<std::pair<int, int>> order;
+	std::unordered_map<int, std::list<std::pair<int, int>>::iterator> map;
+	std::srand(5);
+	for (int step = 0; step < 100000; step++) {
+		int key = std::rand() % 300;
+		int op = std::rand() % 4;
+		if (op == 0) {
+			bool cached = map.count(key) != 0;
+			bool erased = cache.erase(key);
+			assert(erased == cached);
+			if (cached) {
+				order.erase(map[key]);
+				map.erase(key);
+			}
+		} else if (op == 1) {
+			int v = -1;
+			bool hit = cache.get(key, v);
+			assert(hit == (map.count(key) != 0));
+			if (hit) {
+				assert(v == map[key]->second);
+				order.splice(order.begin(), order, map[key]);
+			}
+		} else {
+			cache.put(key, step);
+			if (map.count(key) != 0) {
+				order.erase(map[key]);
+			}
+			order.push_front(std::make_pair(key, step));
+			map[key] = order.begin();
+			if (order.size() > 100) {
+				map.erase(order.back().first);
+				order.pop_back();
+			}
+		}
+		assert(cache.get_size() == order.size());
+	}
+	for (const std::pair<int, int>& p : order) {
+		assert(cache.contains(p.first));
+	}
+}
+
+int main()
+{
+	test_evicts_least_recently_used();
+	test_erase_and_clear();
+	test_capacity_in_bytes();
+	test_against_model();
+	std::cout << "All LRUCache tests passed!\n";
+	return 0;
+}
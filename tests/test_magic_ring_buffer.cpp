@@ -0,0 +1,131 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include "data_structures/magic_ring_buffer.h"
+
+void test_capacity_rounding()
+{
+	DataStructures::MagicRingBuffer<> rb(1);
+	size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+	assert(rb.get_capacity() == page);
+	assert(rb.is_empty());
+	assert(!rb.is_full());
+	DataStructures::MagicRingBuffer<uint32_t> records(page + 1);
+	assert(records.get_capacity() * sizeof(uint32_t) % page == 0);
+	assert(records.get_capacity() >= page + 1);
+}
+
+void test_wraparound_is_contiguous()
+{
+	DataStructures::MagicRingBuffer<int> rb(1);
+	size_t cap = rb.get_capacity();
+	// Move the head close to the end of the first view.
+	size_t lead = cap - 3;
+	rb.commit_write(lead);
+	rb.commit_read(lead);
+	assert(rb.is_empty());
+	DataStructures::Span<int> out = rb.write_span();
+	assert(out.size() == cap);
+	for (size_t i = 0; i < 10; i++) {
+		out[i] = int(i);
+	}
+	rb.commit_write(10);
+	DataStructures::Span<const int> in = rb.read_span();
+	assert(in.size() == 10);
+	for (size_t i = 0; i < 10; i++) {
+		assert(in[i] == int(i));
+	}
+	// The wrapped elements alias the start of the buffer.
+	rb.commit_read(3);
+	assert(rb.read_span()[0] == 3);
+	assert(rb.read_span().data() == in.data() + 3 - cap);
+}
+
+void test_copy_functions()
+{
+	DataStructures::MagicRingBuffer<char> rb(1);
+	size_t cap = rb.get_capacity();
+	std::string block(cap - 1, 'x');
+	assert(rb.write(block.data(), block.size()) == block.size());
+	char sink[16];
+	assert(rb.read(sink, sizeof(sink)) == sizeof(sink));
+	const char msg[] = "wrapped message";
+	assert(rb.write(msg, sizeof(msg)) == sizeof(msg));
+	assert(rb.read(nullptr, 0) == 0);
+	std::string rest(cap, '\0');
+	size_t n = rb.read(&rest[0], rest.size());
+	assert(n == block.size() - sizeof(sink) + sizeof(msg));
+	assert(std::string(&rest[n - sizeof(msg)]) == msg);
+	assert(rb.is_empty());
+}
+
+void test_commit_errors()
+{
+	DataStructures::MagicRingBuffer<> rb(1);
+	bool caught1 = false, caught2 = false;
+	try {
+		rb.commit_read(1);
+	} catch (const std::out_of_range&) {
+		caught1 = true;
+	}
+	try {
+		rb.commit_write(rb.get_capacity() + 1);
+	} catch (const std::out_of_range&) {
+		caught2 = true;
+	}
+	assert(caught1 && caught2);
+	rb.commit_write(rb.get_capacity());
+	assert(rb.is_full());
+	assert(rb.write_span().empty());
+}
+
+void test_fd_io()
+{
+	int fds[2];
+	assert(pipe(fds) == 0);
+	DataStructures::MagicRingBuffer<> rb(1);
+	size_t cap = rb.get_capacity();
+	rb.commit_write(cap - 4);
+	rb.commit_read(cap - 4);
+	const char msg[] = "hello, ring";
+	assert(write(fds[1], msg, sizeof(msg)) == ssize_t(sizeof(msg)));
+	assert(rb.read_from(fds[0]) == ssize_t(sizeof(msg)));
+	assert(rb.get_size() == sizeof(msg));
+	assert(rb.write_to(fds[1]) == ssize_t(sizeof(msg)));
+	assert(rb.is_empty());
+	char back[sizeof(msg)];
+	assert(read(fds[0], back, sizeof(back)) == ssize_t(sizeof(msg)));
+	assert(std::string(back) == msg);
+	close(fds[0]);
+	close(fds[1]);
+}
+
+void test_move()
+{
+	DataStructures::MagicRingBuffer<int> a(1);
+	int v = 42;
+	a.write(&v, 1);
+	DataStructures::MagicRingBuffer<int> b(std::move(a));
+	assert(a.get_capacity() == 0);
+	assert(b.get_size() == 1);
+	assert(b.read_span()[0] == 42);
+	DataStructures::MagicRingBuffer<int> c(1);
+	c = std::move(b);
+	assert(c.get_size() == 1);
+	assert(b.get_capacity() == 0);
+}
+
+int main()
+{
+	test_capacity_rounding();
+	test_wraparound_is_contiguous();
+	test_copy_functions();
+	test_commit_errors();
+	test_fd_io();
+	test_move();
+	std::cout << "All MagicRingBuffer tests passed!\n";
+	return 0;
+}
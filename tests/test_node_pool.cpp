@@ -0,0 +1,155 @@
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "data_structures/node_pool.h"
+
+void test_blocks_are_distinct_and_aligned()
+{
+	DataStructures::SlabPool pool(24, 8);
+	assert(pool.block_size() == 24);
+	std::set<void*> seen;
+	for (int i = 0; i < 1000; i++) {
+		void* p = pool.allocate();
+		assert(reinterpret_cast<uintptr_t>(p) % 8 == 0);
+		assert(seen.insert(p).second);
+	}
+	assert(pool.blocks_in_use() == 1000);
+	assert(pool.blocks_reserved() >= 1000);
+}
+
+void test_freed_blocks_are_reused()
+{
+	DataStructures::SlabPool pool(16, 16);
+	std::vector<void*> blocks;
+	for (int i = 0; i < 100; i++) {
+		blocks.push_back(pool.allocate());
+	}
+	size_t slabs = pool.slabs_allocated();
+	for (void* p : blocks) {
+		pool.deallocate(p);
+	}
+	assert(pool.blocks_in_use() == 0);
+	std::set<void*> old(blocks.begin(), blocks.end());
+	for (int i = 0; i < 100; i++) {
+		assert(old.count(pool.allocate()) == 1);
+	}
+	assert(pool.slabs_allocated() == slabs);
+}
+
+void test_release_frees_all_slabs()
+{
+	DataStructures::SlabPool pool(8, 8);
+	assert(pool.slabs_allocated() == 0);
+	for (int i = 0; i < 5000; i++) {
+		pool.allocate();
+	}
+	// Slabs grow, so far fewer slabs than blocks are needed.
+	assert(pool.slabs_allocated() < 10);
+	pool.release();
+	assert(pool.slabs_allocated() == 0);
+	assert(pool.blocks_in_use() == 0);
+	assert(pool.blocks_reserved() == 0);
+	pool.allocate();
+	assert(pool.slabs_allocated() == 1);
+}
+
+struct alignas(64) Wide {
+	char bytes[100];
+};
+
+void test_over_aligned_type()
+{
+	DataStructures::NodePool<Wide> pool;
+	assert(pool.block_size() == 128);
+	for (int i = 0; i < 50; i++) {
+		Wide* w = pool.create();
+		assert(reinterpret_cast<uintptr_t>(w) % 64 == 0);
+	}
+}
+
+void test_create_and_destroy()
+{
+	DataStructures::NodePool<std::string> pool;
+	std::string* a = pool.create("pooled");
+	std::string* b = pool.create(size_t(3), 'x');
+	assert(*a == "pooled");
+	assert(*b == "xxx");
+	assert(pool.blocks_in_use() == 2);
+	pool.destroy(a);
+	assert(pool.blocks_in_use() == 1);
+	std::string* c = pool.create("again");
+	assert(c == a);
+	pool.destroy(b);
+	pool.destroy(c);
+	assert(pool.blocks_in_use() == 0);
+}
+
+void test_merge_takes_over_slabs()
+{
+	DataStructures::SlabPool a(16, 8);
+	DataStructures::SlabPool b(16, 8);
+	std::vector<void*> blocks;
+	for (int i = 0; i < 40; i++) {
+		blocks.push_back(a.allocate());
+		blocks.push_back(b.allocate());
+	}
+	b.deallocate(blocks.back());
+	blocks.pop_back();
+	size_t slabs = a.slabs_allocated() + b.slabs_allocated();
+	a.merge(b);
+	assert(b.blocks_in_use() == 0 && b.slabs_allocated() == 0);
+	assert(a.blocks_in_use() == 79 && a.slabs_allocated() == slabs);
+	std::set<void*> seen(blocks.begin(), blocks.end());
+	void* p = a.allocate();
+	assert(seen.count(p) == 0);
+	blocks.push_back(p);
+	for (void* q : blocks) {
+		a.deallocate(q);
+	}
+	assert(a.blocks_in_use() == 0);
+	DataStructures::SlabPool c(32, 8);
+	c.allocate();
+	bool got = false;
+	try {
+		a.merge(c);
+	} catch (std::invalid_argument&) {
+		got = true;
+	}
+	assert(got);
+}
+
+void test_reserve_gives_one_run()
+{
+	DataStructures::SlabPool pool(24, 8);
+	pool.allocate();
+	pool.reserve(1000);
+	assert(pool.slabs_allocated() == 2);
+	unsigned char* prev = static_cast<unsigned char*>(pool.allocate());
+	for (int i = 1; i < 1000; i++) {
+		unsigned char* p = static_cast<unsigned char*>(pool.allocate());
+		assert(p == prev + pool.block_size());
+		prev = p;
+	}
+	assert(pool.slabs_allocated() == 2);
+	pool.deallocate(prev);
+	pool.reserve(1);
+	assert(pool.slabs_allocated() == 3);
+	assert(pool.allocate() == prev);
+}
+
+int main()
+{
+	test_blocks_are_distinct_and_aligned();
+	test_freed_blocks_are_reused();
+	test_release_frees_all_slabs();
+	test_over_aligned_type();
+	test_create_and_destroy();
+	test_merge_takes_over_slabs();
+	test_reserve_gives_one_run();
+	std::cout << "All NodePool tests passed!\n";
+	return 0;
+}
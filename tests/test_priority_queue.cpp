@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "data_structures/priority_queue.h"
+
+template <size_t Arity>
+void test_pops_in_order()
+{
+	std::srand(42);
+	std::vector<int> values;
+	DataStructures::PriorityQueue<int, std::less<int>, Arity> pq;
+	for (int i = 0; i < 500; i++) {
+		int v = std::rand() % 100;
+		values.push_back(v);
+		pq.push(v);
+	}
+	assert(pq.size() == values.size());
+	std::sort(values.begin(), values.end(), std::greater<int>());
+	for (int v : values) {
+		assert(pq.peek() == v);
+		assert(pq.pop() == v);
+	}
+	assert(pq.is_empty());
+}
+
+template <size_t Arity>
+void test_heapify_constructor()
+{
+	std::vector<int> values;
+	for (int i = 0; i < 300; i++) {
+		values.push_back((i * 7919) % 301);
+	}
+	DataStructures::PriorityQueue<int, std::greater<int>, Arity> pq(
+		values.begin(), values.end());
+	std::sort(values.begin(), values.end());
+	for (int v : values) {
+		assert(pq.pop() == v);
+	}
+}
+
+void test_empty_queue_behavior()
+{
+	DataStructures::PriorityQueue<int> pq;
+	bool caught1 = false, caught2 = false, caught3 = false;
+	try {
+		pq.pop();
+	} catch (const std::out_of_range&) {
+		caught1 = true;
+	}
+	try {
+		pq.peek();
+	} catch (const std::out_of_range&) {
+		caught2 = true;
+	}
+	try {
+		pq.replace_top(1);
+	} catch (const std::out_of_range&) {
+		caught3 = true;
+	}
+	assert(caught1 && caught2 && caught3);
+	assert(pq.push_pop(5) == 5);
+	assert(pq.is_empty());
+	std::vector<int> none;
+	DataStructures::PriorityQueue<int> from_empty(none.begin(),
+						      none.end());
+	assert(from_empty.is_empty());
+}
+
+void test_fused_operations()
+{
+	DataStructures::PriorityQueue<int, std::less<int>, 4> pq;
+	for (int v : {5, 1, 8, 3}) {
+		pq.push(v);
+	}
+	// Greater than the top: handed straight back.
+	assert(pq.push_pop(10) == 10);
+	assert(pq.size() == 4);
+	// Less than the top: top is returned and the element kept.
+	assert(pq.push_pop(4) == 8);
+	assert(pq.peek() == 5);
+	// Always removes the top, even for a greater element.
+	assert(pq.replace_top(9) == 5);
+	assert(pq.peek() == 9);
+	assert(pq.replace_top(0) == 9);
+	std::vector<int> rest;
+	while (!pq.is_empty()) {
+		rest.push_back(pq.pop());
+	}
+	assert((rest == std::vector<int>{4, 3, 1, 0}));
+}
+
+void test_string_queue()
+{
+	DataStructures::PriorityQueue<std::string, std::greater<std::string>, 8>
+		pq;
+	pq.push("pear");
+	pq.push("apple");
+	pq.push("fig");
+	assert(pq.pop() == "apple");
+	assert(pq.pop() == "fig");
+	assert(pq.pop() == "pear");
+}
+
+int main()
+{
+	test_pops_in_order<2>();
+	test_pops_in_order<3>();
+	test_pops_in_order<4>();
+	test_pops_in_order<8>();
+	test_heapify_constructor<2>();
+	test_heapify_constructor<4>();
+	test_heapify_constructor<8>();
+	test_empty_queue_behavior();
+	test_fused_operations();
+	test_string_queue();
+	std::cout << "All PriorityQueue tests passed!\n";
+	return 0;
+}
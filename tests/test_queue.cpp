@@ -0,0 +1,97 @@
+#include <cassert>
+#include <deque>
+#include <iostream>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include "data_structures/queue.h"
+#include "try_ops.h"
+
+template <typename Container>
+void test_fifo_order()
+{
+	DataStructures::Queue<int, Container> queue;
+	assert(queue.is_empty());
+	for (int i = 0; i < 100; i++) {
+		queue.push(i);
+	}
+	assert(queue.size() == 100);
+	assert(queue.peek() == 0);
+	for (int i = 0; i < 50; i++) {
+		assert(queue.pop() == i);
+	}
+	for (int i = 100; i < 150; i++) {
+		queue.push(i);
+	}
+	for (int i = 50; i < 150; i++) {
+		assert(queue.pop() == i);
+	}
+	assert(queue.is_empty());
+}
+
+template <typename Container>
+void test_empty_throws()
+{
+	DataStructures::Queue<int, Container> queue;
+	bool thrown = false;
+	try {
+		queue.pop();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		queue.peek();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+}
+
+template <typename Container>
+void test_backend()
+{
+	test_fifo_order<Container>();
+	test_empty_throws<Container>();
+	check_try_pop_and_peek<DataStructures::Queue<int, Container>>(1, 2);
+}
+
+void test_string_queue()
+{
+	DataStructures::Queue<std::string> queue;
+	queue.push("A");
+	queue.push("B");
+	queue.push("C");
+	assert(queue.pop() == "A");
+	assert(queue.peek() == "B");
+	assert(queue.size() == 2);
+}
+
+void test_swap()
+{
+	DataStructures::Queue<int> a;
+	DataStructures::Queue<int> b;
+	a.push(1);
+	a.push(2);
+	b.push(3);
+	a.swap(b);
+	assert(a.size() == 1 && a.peek() == 3);
+	assert(b.size() == 2 && b.pop() == 1 && b.pop() == 2);
+}
+
+int main()
+{
+	using namespace DataStructures;
+	test_backend<CircularArray<int>>();
+	test_backend<SinglyLinkedList<int>>();
+	test_backend<DoublyLinkedList<int>>();
+	test_backend<CompactLinkedList<int>>();
+	test_backend<UnrolledLinkedList<int>>();
+	test_backend<std::deque<int>>();
+	test_backend<std::list<int>>();
+	test_string_queue();
+	test_swap();
+	std::cout << "All Queue tests passed." << '\n';
+	return 0;
+}
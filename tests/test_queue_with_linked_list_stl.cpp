@@ -2,6 +2,7 @@
 #include <iostream>
 #include <stdexcept>
 #include "data_structures/queue_with_linked_list_stl.h"
+#include "try_ops.h"
 
 void test_push_and_size()
 {
@@ -59,6 +60,8 @@ int main()
 		test_peek();
 		test_pop();
 		test_empty_pop_peek_throws();
+		check_try_pop_and_peek<
+			DataStructures::QueueWithLinkedListSTL<int>>(1, 2);
 		std::cout << "All QueueWithLinkedListSTL tests passed.\n";
 		return 0;
 	} catch (...) {
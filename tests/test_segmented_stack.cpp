@@ -0,0 +1,170 @@
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "data_structures/segmented_stack.h"
+
+/** Element type counting live objects, whose copy can be made to throw. */
+struct Tracked {
+	static int live;
+	static int fuse;
+	int v;
+
+	explicit Tracked(int x) : v(x) { live++; }
+
+	Tracked(const Tracked& other) : v(other.v)
+	{
+		if (fuse-- == 0) {
+			throw std::runtime_error("copy failed");
+		}
+		live++;
+	}
+
+	Tracked& operator=(const Tracked&) = default;
+	~Tracked() { live--; }
+};
+
+int Tracked::live = 0;
+int Tracked::fuse = -1;
+
+void test_lifo_across_chunks()
+{
+	DataStructures::SegmentedStack<int, 4> stack;
+	assert(stack.is_empty());
+	for (int i = 0; i < 37; i++) {
+		stack.push(i);
+	}
+	assert(stack.size() == 37);
+	assert(stack.peek() == 36);
+	for (int i = 36; i >= 0; i--) {
+		assert(stack.pop() == i);
+	}
+	assert(stack.is_empty());
+	stack.push(7);
+	assert(stack.peek() == 7 && stack.size() == 1);
+}
+
+void test_chunk_boundary_oscillation()
+{
+	DataStructures::SegmentedStack<int, 4> stack;
+	for (int i = 0; i < 8; i++) {
+		stack.push(i);
+	}
+	for (int round = 0; round < 10; round++) {
+		stack.push(100 + round);
+		assert(stack.peek() == 100 + round);
+		assert(stack.pop() == 100 + round);
+		assert(stack.pop() == 7);
+		stack.push(7);
+	}
+	assert(stack.size() == 8);
+	for (int i = 7; i >= 0; i--) {
+		assert(stack.pop() == i);
+	}
+}
+
+void test_empty_throws()
+{
+	DataStructures::SegmentedStack<std::string> stack;
+	bool thrown = false;
+	try {
+		stack.pop();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		stack.peek();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	std::string out = "unchanged";
+	bool popped = stack.try_pop(out);
+	bool peeked = stack.try_peek(out);
+	assert(!popped && !peeked && out == "unchanged");
+	stack.push("a");
+	peeked = stack.try_peek(out);
+	assert(peeked && out == "a");
+	popped = stack.try_pop(out);
+	assert(popped && out == "a" && stack.is_empty());
+}
+
+void test_copy_move_and_swap()
+{
+	DataStructures::SegmentedStack<std::string, 3> a;
+	for (int i = 0; i < 7; i++) {
+		a.push(std::to_string(i));
+	}
+	DataStructures::SegmentedStack<std::string, 3> b(a);
+	assert(b.size() == 7);
+	for (int i = 6; i >= 0; i--) {
+		assert(b.pop() == std::to_string(i));
+	}
+	assert(a.size() == 7 && a.peek() == "6");
+	DataStructures::SegmentedStack<std::string, 3> c(std::move(a));
+	assert(a.is_empty() && c.size() == 7);
+	b.push("x");
+	b.swap(c);
+	assert(b.size() == 7 && c.size() == 1 && c.peek() == "x");
+	c = b;
+	assert(c.size() == 7 && c.peek() == "6");
+	a = std::move(b);
+	assert(a.size() == 7 && a.pop() == "6");
+	a.push("y");
+	assert(a.peek() == "y");
+}
+
+void test_elements_are_destroyed()
+{
+	{
+		DataStructures::SegmentedStack<Tracked, 2> stack;
+		for (int i = 0; i < 5; i++) {
+			stack.push(Tracked(i));
+		}
+		assert(Tracked::live == 5);
+		assert(stack.pop().v == 4);
+		assert(Tracked::live == 4);
+		stack.clear();
+		assert(Tracked::live == 0 && stack.is_empty());
+		stack.push(Tracked(9));
+		assert(stack.peek().v == 9);
+	}
+	assert(Tracked::live == 0);
+}
+
+void test_throwing_push_leaves_stack_unchanged()
+{
+	DataStructures::SegmentedStack<Tracked, 2> stack;
+	stack.push(Tracked(0));
+	stack.push(Tracked(1));
+	Tracked t(2);
+	Tracked::fuse = 0;
+	bool thrown = false;
+	try {
+		stack.push(t);
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	Tracked::fuse = -1;
+	assert(thrown && stack.size() == 2);
+	assert(stack.peek().v == 1);
+	stack.push(t);
+	assert(stack.size() == 3 && stack.pop().v == 2);
+	assert(stack.pop().v == 1 && stack.pop().v == 0);
+}
+
+int main()
+{
+	test_lifo_across_chunks();
+	test_chunk_boundary_oscillation();
+	test_empty_throws();
+	test_copy_move_and_swap();
+	test_elements_are_destroyed();
+	test_throwing_push_leaves_stack_unchanged();
+	assert(Tracked::live == 0);
+	std::cout << "All SegmentedStack tests passed." << '\n';
+	return 0;
+}
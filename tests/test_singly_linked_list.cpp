@@ -1,7 +1,14 @@
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 #include "data_structures/singly_linked_list.h"
+#include "try_ops.h"
 
 void test_add_methods()
 {
@@ -75,6 +82,392 @@ void test_exceptions()
 	assert(got1 && got2 && got3);
 }
 
+void test_clear_and_shared_pool()
+{
+	DataStructures::SinglyLinkedList<std::string> a;
+	for (int i = 0; i < 100; i++) {
+		a.add_last(std::to_string(i));
+	}
+	DataStructures::SinglyLinkedList<std::string> b(a.get_pool());
+	b.add_first("b");
+	assert(a.get_pool() == b.get_pool());
+	assert(a.get_pool()->blocks_in_use() == 101);
+	// The pool is shared, so a only gives its nodes back.
+	a.clear();
+	assert(a.is_empty());
+	assert(a.get_pool()->blocks_in_use() == 1);
+	assert(b.get_first() == "b");
+	a.add_last("again");
+	assert(a.get_first() == "again" && a.get_last() == "again");
+	a.add_first("first");
+	assert(a.get(1) == "again");
+}
+
+void test_iterators()
+{
+	DataStructures::SinglyLinkedList<int> list;
+	assert(list.begin() == list.end());
+	for (int i = 0; i < 5; i++) {
+		list.add_last(i);
+	}
+	int expected = 0;
+	for (int& v : list) {
+		assert(v == expected++);
+		v *= 10;
+	}
+	const DataStructures::SinglyLinkedList<int>& ref = list;
+	DataStructures::SinglyLinkedList<int>::const_iterator it = ref.begin();
+	assert(*it == 0 && *++it == 10);
+}
+
+void test_cursor_edits()
+{
+	DataStructures::SinglyLinkedList<int> list;
+	for (int i = 1; i <= 6; i++) {
+		list.add_last(i);
+	}
+	// Drop the odd numbers and surround the even ones with markers.
+	DataStructures::SinglyLinkedList<int>::Cursor c = list.cursor();
+	while (!c.is_end()) {
+		if (c.get() % 2 == 1) {
+			c.erase();
+		} else {
+			c.insert_before(-c.get());
+			c.insert_after(0);
+			c.advance();
+			c.advance();
+		}
+	}
+	c.insert_before(99);
+	int expected[] = {-2, 2, 0, -4, 4, 0, -6, 6, 0, 99};
+	assert(list.get_size() == 10);
+	for (int i = 0; i < 10; i++) {
+		assert(list.get(i) == expected[i]);
+	}
+	assert(list.get_last() == 99);
+	bool got = false;
+	try {
+		c.erase();
+	} catch (std::out_of_range&) {
+		got = true;
+	}
+	assert(got);
+}
+
+void test_erase_if_and_remove()
+{
+	DataStructures::SinglyLinkedList<int> list;
+	for (int i = 0; i < 20; i++) {
+		list.add_last(i % 5);
+	}
+	assert(list.remove(4) == 4);
+	assert(list.get_last() == 3);
+	assert(list.erase_if([](int x) { return x < 2; }) == 8);
+	assert(list.get_size() == 8);
+	for (int v : list) {
+		assert(v == 2 || v == 3);
+	}
+	assert(list.erase_if([](int) { return true; }) == 8);
+	assert(list.is_empty());
+	list.add_last(7);
+	assert(list.get_first() == 7 && list.get_last() == 7);
+}
+
+void test_erase_if_throwing_predicate()
+{
+	DataStructures::SinglyLinkedList<int> list;
+	for (int i = 0; i < 4; i++) {
+		list.add_last(i);
+	}
+	bool thrown = false;
+	try {
+		list.erase_if([](int x) {
+			if (x == 2) {
+				throw std::runtime_error("predicate failed");
+			}
+			return x == 3 || x == 1;
+		});
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	assert(thrown);
+	assert(list.get_size() == 3 && list.get_last() == 3);
+	thrown = false;
+	try {
+		list.erase_if([](int x) {
+			if (x == 2) {
+				throw std::runtime_error("predicate failed");
+			}
+			return x == 0;
+		});
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	assert(thrown && list.get_size() == 2 && list.get_first() == 2);
+	list.erase_if([](int x) { return x == 3; });
+	assert(list.get_size() == 1 && list.get_last() == 2);
+	list.add_last(5);
+	assert((list.freeze() == std::vector<int>{2, 5}));
+}
+
+void test_append_and_splice()
+{
+	DataStructures::SinglyLinkedList<int> a;
+	DataStructures::SinglyLinkedList<int> b;
+	for (int i = 0; i < 3; i++) {
+		a.add_last(i);
+	}
+	for (int i = 3; i < 6; i++) {
+		b.add_last(i);
+	}
+	a.append(std::move(b));
+	assert(a.get_size() == 6 && b.is_empty());
+	for (int i = 0; i < 6; i++) {
+		assert(a.get(i) == i);
+	}
+	b.add_last(100);
+	DataStructures::SinglyLinkedList<int>::Cursor pos = a.cursor();
+	pos.advance();
+	a.splice(pos, b);
+	assert(a.get_size() == 7 && b.is_empty() && a.get(1) == 100);
+	assert(pos.get() == 100);
+	b.add_last(-1);
+	b.add_last(-2);
+	a.splice(a.cursor(), b);
+	assert(a.get_first() == -1 && a.get(1) == -2 && a.get(2) == 0);
+	DataStructures::SinglyLinkedList<int> moved(std::move(a));
+	assert(moved.get_size() == 9 && a.is_empty());
+	assert(moved.get_last() == 5);
+}
+
+void test_range_splice_and_split()
+{
+	DataStructures::SinglyLinkedList<int> a;
+	DataStructures::SinglyLinkedList<int> b;
+	for (int i = 0; i < 10; i++) {
+		a.add_last(i);
+	}
+	DataStructures::SinglyLinkedList<int>::Cursor first = a.cursor();
+	first.advance();
+	first.advance();
+	DataStructures::SinglyLinkedList<int>::Cursor last = first;
+	for (int i = 0; i < 3; i++) {
+		last.advance();
+	}
+	b.splice(b.end_cursor(), a, first, last);
+	assert(b.get_size() == 3 && a.get_size() == 7);
+	assert(b.get_first() == 2 && b.get_last() == 4);
+	assert(a.get(1) == 1 && a.get(2) == 5);
+	first = a.cursor();
+	last = a.cursor();
+	last.advance();
+	b.splice(b.cursor(), a, first, last, 1);
+	assert(b.get_first() == 0 && b.get_size() == 4);
+	assert(a.get_first() == 1 && a.get_last() == 9);
+	DataStructures::SinglyLinkedList<int>::Cursor mid = a.cursor();
+	for (int i = 0; i < 3; i++) {
+		mid.advance();
+	}
+	DataStructures::SinglyLinkedList<int> rest = a.split_at(mid);
+	assert(a.get_size() == 3 && a.get_last() == 6);
+	assert(rest.get_size() == 3 && rest.get_first() == 7);
+	assert(rest.get_last() == 9 && rest.get_pool() == a.get_pool());
+	rest.add_last(10);
+	assert(rest.get_last() == 10 && a.get_last() == 6);
+	DataStructures::SinglyLinkedList<int> none = a.split_at(a.end_cursor());
+	assert(none.is_empty() && a.get_size() == 3);
+}
+
+void test_splice_between_pools()
+{
+	DataStructures::SinglyLinkedList<int> a;
+	DataStructures::SinglyLinkedList<int> b;
+	a.add_last(1);
+	b.add_last(2);
+	assert(a.get_pool() != b.get_pool());
+	a.splice(a.end_cursor(), b);
+	assert(a.get_pool() == b.get_pool());
+	assert(a.get_pool()->blocks_in_use() == 2);
+	DataStructures::SinglyLinkedList<int> c(a.get_pool());
+	DataStructures::SinglyLinkedList<int> d;
+	DataStructures::SinglyLinkedList<int> e(d.get_pool());
+	d.add_last(3);
+	a.splice(a.end_cursor(), d);
+	assert(d.is_empty() && a.get_size() == 3 && a.get_last() == 3);
+	assert(a.get_pool() != d.get_pool());
+	while (!a.is_empty()) {
+		a.del_first();
+	}
+	assert(a.get_pool()->blocks_in_use() == 0);
+}
+
+typedef std::pair<int, int> Record;
+
+bool by_key(const Record& a, const Record& b) { return a.first < b.first; }
+
+void test_sort_is_stable()
+{
+	DataStructures::SinglyLinkedList<Record> list;
+	std::vector<Record> ref;
+	std::srand(5);
+	for (int i = 0; i < 1000; i++) {
+		Record r(std::rand() % 50, i);
+		list.add_last(r);
+		ref.push_back(r);
+	}
+	size_t reserved = list.get_pool()->blocks_reserved();
+	list.sort(by_key);
+	std::stable_sort(ref.begin(), ref.end(), by_key);
+	assert(list.get_size() == 1000);
+	assert(list.get_pool()->blocks_reserved() == reserved);
+	size_t k = 0;
+	for (const Record& r : list) {
+		assert(r == ref[k++]);
+	}
+	assert(list.get_last() == ref.back());
+	list.add_last(Record(-1, 0));
+	list.sort(by_key);
+	assert(list.get_first().first == -1 && list.get_last() == ref.back());
+	DataStructures::SinglyLinkedList<int> empty;
+	empty.sort();
+	assert(empty.is_empty());
+}
+
+void test_merge_sorted_lists()
+{
+	DataStructures::SinglyLinkedList<int> a;
+	DataStructures::SinglyLinkedList<int> b;
+	DataStructures::SinglyLinkedList<int> c(b.get_pool());
+	for (int i = 0; i < 10; i++) {
+		a.add_last(3 * i);
+		b.add_last(2 * i);
+	}
+	a.merge(b);
+	assert(b.is_empty() && a.get_size() == 20);
+	assert(a.get_last() == 27);
+	int prev = -1;
+	for (int v : a) {
+		assert(v >= prev);
+		prev = v;
+	}
+	c.add_last(100);
+	a.merge(c);
+	assert(a.get_last() == 100 && c.is_empty());
+	a.add_last(200);
+	assert(a.get_size() == 22 && a.get_last() == 200);
+
+	DataStructures::SinglyLinkedList<int> d;
+	d.add_last(5);
+	DataStructures::SinglyLinkedList<int> lists[5];
+	std::vector<DataStructures::SinglyLinkedList<int>*> others;
+	for (int j = 0; j < 5; j++) {
+		for (int i = 0; i < 4; i++) {
+			lists[j].add_last(j + 5 * i);
+		}
+		others.push_back(&lists[j]);
+	}
+	d.merge(others);
+	assert(d.get_size() == 21);
+	int expected[] = {0, 1, 2, 3, 4, 5, 5, 6};
+	for (int i = 0; i < 8; i++) {
+		assert(d.get(i) == expected[i]);
+	}
+	assert(d.get_last() == 19);
+	for (int j = 0; j < 5; j++) {
+		assert(lists[j].is_empty());
+	}
+	DataStructures::SinglyLinkedList<int> e;
+	d.sort(std::greater<int>());
+	e.add_last(10);
+	e.merge(d, std::greater<int>());
+	assert(e.get_size() == 22 && e.get_first() == 19);
+	assert(e.get(9) == 10 && e.get(10) == 10 && e.get_last() == 0);
+}
+
+struct NoDefault {
+	int v;
+	explicit NoDefault(int x) : v(x) {}
+};
+
+void test_move_and_swap()
+{
+	DataStructures::SinglyLinkedList<int> a;
+	assert(a.begin() == a.end());
+	for (int i = 0; i < 5; i++) {
+		a.add_last(i);
+	}
+	DataStructures::SinglyLinkedList<int> b(std::move(a));
+	assert(a.is_empty() && a.begin() == a.end());
+	assert(b.get_size() == 5 && b.get_last() == 4);
+	a.add_last(9);
+	a.swap(b);
+	assert(a.get_size() == 5 && b.get_size() == 1);
+	assert(a.get_first() == 0 && b.get_first() == 9);
+	b.add_last(10);
+	assert(b.get_last() == 10);
+	b = std::move(a);
+	assert(a.is_empty() && b.get_size() == 5);
+	int k = 0;
+	for (int v : b) {
+		assert(v == k++);
+	}
+	DataStructures::SinglyLinkedList<int> empty;
+	empty.swap(b);
+	assert(b.is_empty() && empty.get_size() == 5);
+	b.add_first(1);
+	assert(b.get_first() == 1 && b.get_last() == 1);
+
+	DataStructures::SinglyLinkedList<NoDefault> nd;
+	nd.add_last(NoDefault(3));
+	assert(nd.get_first().v == 3);
+}
+
+void test_compact_and_freeze()
+{
+	typedef DataStructures::SinglyLinkedList<std::string> List;
+	List list;
+	List other(list.get_pool());
+	for (int i = 0; i < 300; i++) {
+		list.add(i % 7 == 0 ? 0 : int(list.get_size()) / 2,
+			 std::to_string(i));
+		other.add_last(std::to_string(i));
+	}
+	list.erase_if([](const std::string& s) { return s.size() == 2; });
+	std::vector<std::string> before = list.freeze();
+	assert(before.size() == list.get_size());
+	list.compact();
+	assert(list.get_pool() != other.get_pool());
+	assert(list.get_pool()->slabs_allocated() == 1);
+	assert(list.freeze() == before);
+	const std::string* prev = nullptr;
+	for (const std::string& s : list) {
+		assert(prev == nullptr || &s > prev);
+		prev = &s;
+	}
+	list.add_last("x");
+	assert(list.get_last() == "x" && list.get_first() == before[0]);
+	assert(other.get_size() == 300 && other.get(299) == "299");
+
+	List empty;
+	empty.compact();
+	assert(empty.is_empty() && empty.freeze().empty());
+}
+
+void test_prepend_reversed()
+{
+	DataStructures::SinglyLinkedList<int> list;
+	std::vector<int> in = {1, 2, 3};
+	list.prepend_reversed(in.begin(), in.end());
+	assert(list.get_size() == 3);
+	assert((list.freeze() == std::vector<int>{3, 2, 1}));
+	list.add_last(0);
+	assert(list.get_last() == 0);
+	list.prepend_reversed(in.begin(), in.begin() + 2);
+	assert((list.freeze() == std::vector<int>{2, 1, 3, 2, 1, 0}));
+	list.prepend_reversed(in.begin(), in.begin());
+	assert(list.get_size() == 6);
+}
+
 int main()
 {
 	try {
@@ -83,6 +476,20 @@ int main()
 		test_get_methods();
 		test_set_method();
 		test_exceptions();
+		test_clear_and_shared_pool();
+		test_iterators();
+		test_cursor_edits();
+		test_erase_if_and_remove();
+		test_erase_if_throwing_predicate();
+		test_append_and_splice();
+		test_range_splice_and_split();
+		test_splice_between_pools();
+		test_sort_is_stable();
+		test_merge_sorted_lists();
+		test_move_and_swap();
+		test_compact_and_freeze();
+		check_try_del<DataStructures::SinglyLinkedList<int>>();
+		test_prepend_reversed();
 		std::cout << "All SinglyLinkedList tests passed.\n";
 		return 0;
 	} catch (...) {
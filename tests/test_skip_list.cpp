@@ -0,0 +1,186 @@
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "data_structures/skip_list.h"
+#include "try_ops.h"
+
+void test_add_keeps_order()
+{
+	DataStructures::SkipList<int> list;
+	assert(list.is_empty());
+	std::vector<int> ref;
+	std::srand(7);
+	for (int i = 0; i < 2000; i++) {
+		int v = std::rand() % 500;
+		list.add(v);
+		ref.insert(std::upper_bound(ref.begin(), ref.end(), v), v);
+	}
+	assert(list.get_size() == 2000);
+	for (int i = 0; i < 2000; i++) {
+		assert(list.get(i) == ref[size_t(i)]);
+	}
+	assert(list.get_first() == ref.front());
+	assert(list.get_last() == ref.back());
+	size_t k = 0;
+	for (int v : list) {
+		assert(v == ref[k++]);
+	}
+}
+
+void test_delete_by_index_and_key()
+{
+	DataStructures::SkipList<int> list;
+	std::vector<int> ref;
+	for (int i = 0; i < 1000; i++) {
+		list.add(i % 100);
+		ref.push_back(i % 100);
+	}
+	std::sort(ref.begin(), ref.end());
+	std::srand(3);
+	while (ref.size() > 500) {
+		int i = std::rand() % int(ref.size());
+		assert(list.del(i) == ref[size_t(i)]);
+		ref.erase(ref.begin() + i);
+	}
+	for (size_t i = 0; i < ref.size(); i++) {
+		assert(list.get(int(i)) == ref[i]);
+	}
+	size_t sevens = size_t(std::count(ref.begin(), ref.end(), 7));
+	assert(list.remove(7) == sevens);
+	assert(!list.contains(7) && list.index_of(7) == -1);
+	assert(list.remove(1000) == 0);
+	assert(list.del_first() == ref.front());
+	assert(list.del_last() == ref.back());
+	assert(list.get_size() == ref.size() - sevens - 2);
+	while (!list.is_empty()) {
+		list.del_last();
+	}
+	list.add(5);
+	assert(list.get_first() == 5 && list.get_last() == 5);
+}
+
+void test_index_of()
+{
+	DataStructures::SkipList<std::string> list;
+	list.add("pear");
+	list.add("apple");
+	list.add("fig");
+	list.add("apple");
+	assert(list.index_of("apple") == 0);
+	assert(list.index_of("fig") == 2);
+	assert(list.index_of("pear") == 3);
+	assert(list.index_of("kiwi") == -1);
+	assert(list.contains("fig"));
+}
+
+void test_add_at_position()
+{
+	DataStructures::SkipList<int, std::greater<int>> list;
+	list.add(0, 10);
+	list.add(1, 5);
+	list.add(0, 20);
+	list.add(1, 15);
+	list.add(4, 5);
+	int expected[] = {20, 15, 10, 5, 5};
+	for (int i = 0; i < 5; i++) {
+		assert(list.get(i) == expected[i]);
+	}
+	bool got = false;
+	try {
+		list.add(0, 1);
+	} catch (std::invalid_argument&) {
+		got = true;
+	}
+	assert(got && list.get_size() == 5);
+}
+
+void test_exceptions()
+{
+	DataStructures::SkipList<int> list;
+	int thrown = 0;
+	try {
+		list.del_first();
+	} catch (std::out_of_range&) {
+		thrown++;
+	}
+	try {
+		list.get_last();
+	} catch (std::out_of_range&) {
+		thrown++;
+	}
+	list.add(1);
+	try {
+		list.get(1);
+	} catch (std::out_of_range&) {
+		thrown++;
+	}
+	try {
+		list.add(2, 3);
+	} catch (std::out_of_range&) {
+		thrown++;
+	}
+	assert(thrown == 4);
+}
+
+void test_clear()
+{
+	DataStructures::SkipList<std::string> list;
+	for (int i = 0; i < 300; i++) {
+		list.add(std::to_string(i));
+	}
+	list.clear();
+	assert(list.is_empty() && list.begin() == list.end());
+	list.add("b");
+	list.add("a");
+	assert(list.get(0) == "a" && list.get(1) == "b");
+}
+
+void test_move_and_swap()
+{
+	DataStructures::SkipList<int> a;
+	for (int i = 0; i < 300; i++) {
+		a.add(i);
+	}
+	DataStructures::SkipList<int> b(std::move(a));
+	assert(a.is_empty() && b.get_size() == 300);
+	a.add(5);
+	a.add(1);
+	a.swap(b);
+	assert(a.get_size() == 300 && b.get_size() == 2);
+	assert(a.get(150) == 150 && b.get(0) == 1);
+	b = std::move(a);
+	assert(a.is_empty() && b.get_size() == 300);
+	assert(b.index_of(299) == 299);
+	a.add(3);
+	assert(a.get_first() == 3);
+}
+
+void test_try_del()
+{
+	DataStructures::SkipList<int> list;
+	list.add(3);
+	list.add(1);
+	list.add(2);
+	check_try_del_ends(list);
+	assert(list.is_empty());
+}
+
+int main()
+{
+	test_add_keeps_order();
+	test_delete_by_index_and_key();
+	test_index_of();
+	test_add_at_position();
+	test_exceptions();
+	test_clear();
+	test_move_and_swap();
+	test_try_del();
+	std::cout << "All SkipList tests passed!\n";
+	return 0;
+}
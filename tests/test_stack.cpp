@@ -0,0 +1,164 @@
+#include <cassert>
+#include <deque>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "data_structures/stack.h"
+#include "try_ops.h"
+
+template <typename Container>
+void test_lifo_order()
+{
+	DataStructures::Stack<int, Container> stack;
+	assert(stack.is_empty());
+	for (int i = 0; i < 100; i++) {
+		stack.push(i);
+	}
+	assert(stack.size() == 100);
+	assert(stack.peek() == 99);
+	for (int i = 99; i >= 0; i--) {
+		assert(stack.pop() == i);
+	}
+	assert(stack.is_empty());
+}
+
+template <typename Container>
+void test_empty_throws()
+{
+	DataStructures::Stack<int, Container> stack;
+	bool thrown = false;
+	try {
+		stack.pop();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	thrown = false;
+	try {
+		stack.peek();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+}
+
+template <typename Container>
+void test_push_n_and_pop_n()
+{
+	DataStructures::Stack<int, Container> stack;
+	std::vector<int> in = {1, 2, 3, 4, 5};
+	stack.push(0);
+	stack.push_n(in.begin(), in.end());
+	assert(stack.size() == 6);
+	assert(stack.peek() == 5);
+	assert((stack.peek_n(3) == std::vector<int>{5, 4, 3}));
+	std::vector<int> out;
+	stack.pop_n(std::back_inserter(out), 4);
+	assert((out == std::vector<int>{5, 4, 3, 2}));
+	assert(stack.size() == 2);
+	assert(stack.peek() == 1);
+	bool thrown = false;
+	try {
+		stack.pop_n(std::back_inserter(out), 3);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	assert(stack.size() == 2 && out.size() == 4);
+	stack.pop_n(std::back_inserter(out), 2);
+	assert(stack.size() == 0 && out.back() == 0);
+	stack.push_n(in.begin(), in.begin());
+	assert(stack.size() == 0);
+}
+
+struct CopyBomb {
+	static int fuse;
+	int v;
+
+	CopyBomb(int x) : v(x) {}
+
+	CopyBomb(const CopyBomb& other) : v(other.v)
+	{
+		if (fuse-- == 0) {
+			throw std::runtime_error("copy failed");
+		}
+	}
+
+	CopyBomb& operator=(const CopyBomb&) = default;
+};
+
+int CopyBomb::fuse = -1;
+
+template <typename Container>
+void test_push_n_is_all_or_nothing()
+{
+	DataStructures::Stack<CopyBomb, Container> stack;
+	stack.push(CopyBomb(0));
+	std::vector<CopyBomb> more(4, CopyBomb(1));
+	CopyBomb::fuse = 2;
+	bool thrown = false;
+	try {
+		stack.push_n(more.begin(), more.end());
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	CopyBomb::fuse = -1;
+	assert(thrown && stack.size() == 1 && stack.peek().v == 0);
+	stack.push_n(more.begin(), more.end());
+	assert(stack.size() == 5 && stack.peek().v == 1);
+}
+
+template <typename Container>
+void test_backend()
+{
+	test_lifo_order<Container>();
+	test_empty_throws<Container>();
+	test_push_n_and_pop_n<Container>();
+	check_try_pop_and_peek<DataStructures::Stack<int, Container>>(2, 1);
+}
+
+void test_string_stack()
+{
+	DataStructures::Stack<std::string> stack;
+	stack.push("A");
+	stack.push("B");
+	stack.push("C");
+	assert(stack.pop() == "C");
+	assert(stack.peek() == "B");
+	assert(stack.size() == 2);
+}
+
+void test_swap()
+{
+	DataStructures::Stack<int> a;
+	DataStructures::Stack<int> b;
+	a.push(1);
+	a.push(2);
+	b.push(3);
+	a.swap(b);
+	assert(a.size() == 1 && a.peek() == 3);
+	assert(b.size() == 2 && b.pop() == 2 && b.pop() == 1);
+}
+
+int main()
+{
+	using namespace DataStructures;
+	test_backend<DynamicArray<int>>();
+	test_backend<CircularArray<int>>();
+	test_backend<SinglyLinkedList<int>>();
+	test_backend<DoublyLinkedList<int>>();
+	test_backend<CompactLinkedList<int>>();
+	test_backend<UnrolledLinkedList<int>>();
+	test_backend<std::vector<int>>();
+	test_backend<std::deque<int>>();
+	test_backend<std::list<int>>();
+	test_push_n_is_all_or_nothing<SinglyLinkedList<CopyBomb>>();
+	test_push_n_is_all_or_nothing<DoublyLinkedList<CopyBomb>>();
+	test_string_stack();
+	test_swap();
+	std::cout << "All Stack tests passed." << '\n';
+	return 0;
+}
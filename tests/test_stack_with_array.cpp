@@ -1,7 +1,11 @@
 #include <cassert>
 #include <string>
 #include <iostream>
+#include <iterator>
+#include <stdexcept>
+#include <vector>
 #include "data_structures/stack_with_array.h"
+#include "try_ops.h"
 
 void test_push_and_peek()
 {
@@ -34,11 +38,41 @@ void test_string_stack()
 	assert(stack.size() == 2);
 }
 
+void test_push_n_and_pop_n()
+{
+	DataStructures::StackWithArray<int> stack;
+	std::vector<int> in = {1, 2, 3, 4, 5};
+	stack.push(0);
+	stack.push_n(in.begin(), in.end());
+	assert(stack.size() == 6);
+	assert(stack.peek() == 5);
+	assert((stack.peek_n(3) == std::vector<int>{5, 4, 3}));
+	std::vector<int> out;
+	stack.pop_n(std::back_inserter(out), 4);
+	assert((out == std::vector<int>{5, 4, 3, 2}));
+	assert(stack.size() == 2);
+	assert(stack.peek() == 1);
+	bool thrown = false;
+	try {
+		stack.pop_n(std::back_inserter(out), 3);
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	assert(stack.size() == 2 && out.size() == 4);
+	stack.pop_n(std::back_inserter(out), 2);
+	assert(stack.size() == 0 && out.back() == 0);
+	stack.push_n(in.begin(), in.begin());
+	assert(stack.size() == 0);
+}
+
 int main()
 {
 	test_push_and_peek();
 	test_pop();
 	test_string_stack();
+	check_try_pop_and_peek<DataStructures::StackWithArray<int>>(2, 1);
+	test_push_n_and_pop_n();
 	std::cout << "All StackWithArray tests passed." << '\n';
 	return 0;
 }
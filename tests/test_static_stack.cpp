@@ -0,0 +1,133 @@
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include "data_structures/static_stack.h"
+
+static_assert(DataStructures::StaticStack<int, 64>::capacity() == 64,
+	      "capacity() is a constant expression");
+
+/** Element type without a default constructor, counting live objects. */
+struct Tracked {
+	static int live;
+	int v;
+
+	explicit Tracked(int x) : v(x) { live++; }
+	Tracked(const Tracked& other) : v(other.v) { live++; }
+	Tracked& operator=(const Tracked&) = default;
+	~Tracked() { live--; }
+};
+
+int Tracked::live = 0;
+
+void test_push_pop_and_peek()
+{
+	DataStructures::StaticStack<int, 4> stack;
+	assert(stack.is_empty());
+	stack.push(10);
+	stack.push(20);
+	stack.push(30);
+	assert(stack.peek() == 30);
+	assert(stack.size() == 3);
+	assert(stack.pop() == 30);
+	assert(stack.pop() == 20);
+	assert(stack.peek() == 10);
+	assert(stack.size() == 1);
+}
+
+void test_full_and_empty_throw()
+{
+	DataStructures::StaticStack<int, 2> stack;
+	stack.push(1);
+	stack.push(2);
+	bool thrown = false;
+	try {
+		stack.push(3);
+	} catch (const std::length_error&) {
+		thrown = true;
+	}
+	assert(thrown && stack.size() == 2 && stack.peek() == 2);
+	stack.pop();
+	stack.pop();
+	thrown = false;
+	try {
+		stack.pop();
+	} catch (const std::out_of_range&) {
+		thrown = true;
+	}
+	assert(thrown);
+	int out = -1;
+	bool popped = stack.try_pop(out);
+	bool peeked = stack.try_peek(out);
+	assert(!popped && !peeked && out == -1);
+}
+
+void test_spill_to_heap()
+{
+	DataStructures::StaticStack<std::string, 2, true> stack;
+	for (int i = 0; i < 10; i++) {
+		stack.push(std::to_string(i));
+	}
+	assert(stack.size() == 10);
+	assert(stack.peek() == "9");
+	for (int i = 9; i >= 0; i--) {
+		std::string out;
+		bool peeked = stack.try_peek(out);
+		assert(peeked && out == std::to_string(i));
+		bool popped = stack.try_pop(out);
+		assert(popped && out == std::to_string(i));
+	}
+	assert(stack.is_empty());
+	stack.push("a");
+	stack.push("b");
+	stack.push("c");
+	assert(stack.pop() == "c" && stack.pop() == "b");
+	assert(stack.size() == 1);
+}
+
+void test_copy_and_move()
+{
+	DataStructures::StaticStack<std::string, 2, true> a;
+	a.push("x");
+	a.push("y");
+	a.push("z");
+	DataStructures::StaticStack<std::string, 2, true> b(a);
+	assert(b.size() == 3 && b.pop() == "z" && b.pop() == "y");
+	DataStructures::StaticStack<std::string, 2, true> c(std::move(a));
+	assert(a.is_empty() && c.size() == 3 && c.peek() == "z");
+	b = c;
+	assert(b.size() == 3 && b.peek() == "z");
+	a = std::move(b);
+	assert(b.is_empty() && a.size() == 3);
+	assert(a.pop() == "z" && a.pop() == "y" && a.pop() == "x");
+}
+
+void test_elements_are_destroyed()
+{
+	{
+		DataStructures::StaticStack<Tracked, 3, true> stack;
+		for (int i = 0; i < 5; i++) {
+			stack.push(Tracked(i));
+		}
+		assert(Tracked::live == 5);
+		assert(stack.pop().v == 4);
+		assert(Tracked::live == 4);
+		DataStructures::StaticStack<Tracked, 3, true> copy(stack);
+		assert(Tracked::live == 8);
+		copy.clear();
+		assert(Tracked::live == 4 && copy.is_empty());
+	}
+	assert(Tracked::live == 0);
+}
+
+int main()
+{
+	test_push_pop_and_peek();
+	test_full_and_empty_throw();
+	test_spill_to_heap();
+	test_copy_and_move();
+	test_elements_are_destroyed();
+	std::cout << "All StaticStack tests passed." << '\n';
+	return 0;
+}
@@ -0,0 +1,227 @@
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "data_structures/unrolled_linked_list.h"
+#include "try_ops.h"
+
+void test_add_and_get()
+{
+	DataStructures::UnrolledLinkedList<int, 4> list;
+	assert(list.is_empty());
+	for (int i = 0; i < 10; i++) {
+		list.add_last(i);
+	}
+	list.add_first(-1);
+	assert(list.get_size() == 11);
+	assert(list.get_first() == -1);
+	assert(list.get_last() == 9);
+	for (int i = 0; i < 10; i++) {
+		assert(list.get(i + 1) == i);
+	}
+	list.add(5, 100);
+	assert(list.get(5) == 100 && list.get(6) == 4);
+	assert(list.set(5, 200) == 100);
+	assert(list.get(5) == 200);
+}
+
+void test_delete()
+{
+	DataStructures::UnrolledLinkedList<std::string, 4> list;
+	for (int i = 0; i < 20; i++) {
+		list.add_last(std::to_string(i));
+	}
+	assert(list.del_first() == "0");
+	assert(list.del_last() == "19");
+	assert(list.del(5) == "6");
+	assert(list.get(5) == "7");
+	while (!list.is_empty()) {
+		list.del_first();
+	}
+	assert(list.node_count() == 0);
+}
+
+void test_iteration()
+{
+	DataStructures::UnrolledLinkedList<int, 8> list;
+	for (int i = 0; i < 100; i++) {
+		list.add_last(i);
+	}
+	int expected = 0;
+	for (int& v : list) {
+		assert(v == expected++);
+		v *= 2;
+	}
+	assert(expected == 100);
+	const DataStructures::UnrolledLinkedList<int, 8>& ref = list;
+	DataStructures::UnrolledLinkedList<int, 8>::const_iterator it =
+		ref.begin();
+	assert(*it == 0 && *++it == 2);
+	assert(list.begin() != list.end());
+	DataStructures::UnrolledLinkedList<int, 8> empty;
+	assert(empty.begin() == empty.end());
+}
+
+void test_nodes_stay_packed()
+{
+	DataStructures::UnrolledLinkedList<int, 8> list;
+	for (int i = 0; i < 800; i++) {
+		list.add_last(i);
+	}
+	assert(list.node_count() == 100);
+	// Deleting every other element keeps every node but the last at least
+	// half full.
+	for (int i = 0; i < 400; i++) {
+		list.del(i);
+	}
+	assert(list.get_size() == 400);
+	assert(list.node_count() <= 400 / 4 + 1);
+	for (int i = 0; i < 400; i++) {
+		assert(list.get(i) == 2 * i + 1);
+	}
+}
+
+/* Mirrors random operations on a std::vector, with small nodes to force
+ * frequent splits and merges. */
+void test_against_vector()
+{
+	DataStructures::UnrolledLinkedList<int, 3> list;
+	std::vector<int> ref;
+	std::srand(7);
+	for (int step = 0; step < 20000; step++) {
+		int op = std::rand() % 6;
+		int n = int(ref.size());
+		if (op <= 2 || n == 0) {
+			int pos = std::rand() % (n + 1);
+			list.add(pos, step);
+			ref.insert(ref.begin() + pos, step);
+		} else if (op == 3) {
+			int pos = std::rand() % n;
+			assert(list.del(pos) == ref[size_t(pos)]);
+			ref.erase(ref.begin() + pos);
+		} else if (op == 4) {
+			assert(list.del_first() == ref.front());
+			ref.erase(ref.begin());
+		} else {
+			assert(list.del_last() == ref.back());
+			ref.pop_back();
+		}
+		assert(list.get_size() == ref.size());
+	}
+	size_t i = 0;
+	for (int v : list) {
+		assert(v == ref[i++]);
+	}
+	assert(i == ref.size());
+}
+
+void test_exceptions()
+{
+	DataStructures::UnrolledLinkedList<int> list;
+	bool got1 = false, got2 = false, got3 = false, got4 = false;
+	try {
+		list.del_first();
+	} catch (std::out_of_range&) {
+		got1 = true;
+	}
+	try {
+		list.get_last();
+	} catch (std::out_of_range&) {
+		got2 = true;
+	}
+	list.add_last(1);
+	try {
+		list.get(1);
+	} catch (std::out_of_range&) {
+		got3 = true;
+	}
+	try {
+		list.add(3, 1);
+	} catch (std::out_of_range&) {
+		got4 = true;
+	}
+	assert(got1 && got2 && got3 && got4);
+}
+
+void test_move_and_swap()
+{
+	DataStructures::UnrolledLinkedList<int> a;
+	for (int i = 0; i < 100; i++) {
+		a.add_last(i);
+	}
+	DataStructures::UnrolledLinkedList<int> b(std::move(a));
+	assert(a.get_size() == 0 && b.get_size() == 100);
+	a.add_last(7);
+	a.swap(b);
+	assert(a.get_size() == 100 && b.get_size() == 1);
+	b = std::move(a);
+	assert(b.get_size() == 100 && b.get(99) == 99);
+}
+
+struct CopyBomb {
+	static int fuse;
+	int v;
+
+	CopyBomb(int x) : v(x) {}
+
+	CopyBomb(const CopyBomb& other) : v(other.v)
+	{
+		if (fuse-- == 0) {
+			throw std::runtime_error("copy failed");
+		}
+	}
+
+	CopyBomb& operator=(const CopyBomb&) = default;
+};
+
+int CopyBomb::fuse = -1;
+
+void test_throwing_copy_links_no_node()
+{
+	DataStructures::UnrolledLinkedList<CopyBomb, 2> list;
+	CopyBomb x(1);
+	bool thrown = false;
+	CopyBomb::fuse = 0;
+	try {
+		list.add_last(x);
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	assert(thrown);
+	assert(list.is_empty() && list.begin() == list.end());
+	list.add_first(x);
+	list.add_first(x);
+	thrown = false;
+	CopyBomb::fuse = 0;
+	try {
+		list.add_first(x);
+	} catch (const std::runtime_error&) {
+		thrown = true;
+	}
+	CopyBomb::fuse = -1;
+	assert(thrown);
+	assert(list.get_size() == 2);
+	size_t n = 0;
+	for (auto it = list.begin(); it != list.end(); ++it) {
+		n++;
+	}
+	assert(n == 2);
+}
+
+int main()
+{
+	test_add_and_get();
+	test_delete();
+	test_iteration();
+	test_nodes_stay_packed();
+	test_against_vector();
+	test_exceptions();
+	test_move_and_swap();
+	check_try_del<DataStructures::UnrolledLinkedList<int>>();
+	test_throwing_copy_links_no_node();
+	std::cout << "All UnrolledLinkedList tests passed!\n";
+	return 0;
+}
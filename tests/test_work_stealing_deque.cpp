@@ -0,0 +1,110 @@
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include "data_structures/work_stealing_deque.h"
+
+void test_owner_is_lifo_thief_is_fifo()
+{
+	DataStructures::WorkStealingDeque<int> dq(2);
+	int v = 0;
+	assert(dq.is_empty());
+	assert(!dq.pop(v));
+	assert(!dq.steal(v));
+	for (int i = 1; i <= 5; i++) {
+		dq.push(i);
+	}
+	assert(dq.size() == 5);
+	assert(dq.capacity() == 8);
+	assert(dq.pop(v) && v == 5);
+	assert(dq.steal(v) && v == 1);
+	assert(dq.pop(v) && v == 4);
+	assert(dq.steal(v) && v == 2);
+	assert(dq.pop(v) && v == 3);
+	assert(!dq.pop(v));
+	assert(!dq.steal(v));
+	assert(dq.is_empty());
+}
+
+void test_growth_keeps_elements()
+{
+	DataStructures::WorkStealingDeque<long> dq(1);
+	std::vector<long> taken;
+	long v;
+	for (long i = 0; i < 1000; i++) {
+		dq.push(i);
+		if (i % 3 == 0) {
+			assert(dq.steal(v));
+			taken.push_back(v);
+		}
+	}
+	assert(dq.capacity() >= dq.size());
+	long prev = 1000;
+	while (dq.pop(v)) {
+		assert(v < prev);
+		prev = v;
+		taken.push_back(v);
+	}
+	assert(taken.size() == 1000);
+	std::vector<bool> present(1000, false);
+	for (long x : taken) {
+		assert(!present[size_t(x)]);
+		present[size_t(x)] = true;
+	}
+}
+
+/*
+ * The owner pushes every value once, occasionally popping some back, while
+ * thieves steal concurrently. Every value must be taken exactly once.
+ */
+void stress(int thieves, int total)
+{
+	DataStructures::WorkStealingDeque<int> dq(4);
+	std::vector<std::atomic<int>> seen(static_cast<size_t>(total));
+	for (std::atomic<int>& s : seen) {
+		s.store(0);
+	}
+	std::atomic<bool> done(false);
+	std::vector<std::thread> threads;
+	for (int i = 0; i < thieves; i++) {
+		threads.emplace_back([&] {
+			int v;
+			while (!done.load()) {
+				if (dq.steal(v)) {
+					seen[size_t(v)].fetch_add(1);
+				}
+			}
+			while (dq.steal(v)) {
+				seen[size_t(v)].fetch_add(1);
+			}
+		});
+	}
+	int v;
+	for (int i = 0; i < total; i++) {
+		dq.push(i);
+		if (i % 7 == 0 && dq.pop(v)) {
+			seen[size_t(v)].fetch_add(1);
+		}
+	}
+	while (dq.pop(v)) {
+		seen[size_t(v)].fetch_add(1);
+	}
+	done.store(true);
+	for (std::thread& t : threads) {
+		t.join();
+	}
+	for (std::atomic<int>& s : seen) {
+		assert(s.load() == 1);
+	}
+}
+
+int main()
+{
+	test_owner_is_lifo_thief_is_fifo();
+	test_growth_keeps_elements();
+	stress(1, 100000);
+	stress(4, 200000);
+	std::cout << "All WorkStealingDeque tests passed!\n";
+	return 0;
+}
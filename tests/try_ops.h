@@ -0,0 +1,97 @@
+#ifndef DATA_STRUCTURES_TESTS_TRY_OPS_H
+#define DATA_STRUCTURES_TESTS_TRY_OPS_H
+
+#include <cassert>
+
+/*
+ * Checks of the non-throwing try_* members shared by the container and
+ * adapter tests. Every call that changes the container is made outside
+ * assert, so the checks still exercise it when NDEBUG is defined.
+ */
+
+/*
+ * Pushes 1 and then 2 onto an empty stack or queue; first and second are
+ * the values it is expected to hand back in that order.
+ */
+template <typename Adapter>
+void check_try_pop_and_peek(int first, int second)
+{
+	Adapter adapter;
+	int out = -1;
+	bool ok = adapter.try_pop(out);
+	assert(!ok);
+	ok = adapter.try_peek(out);
+	assert(!ok && out == -1);
+	adapter.push(1);
+	adapter.push(2);
+	ok = adapter.try_peek(out);
+	assert(ok && out == first);
+	ok = adapter.try_pop(out);
+	assert(ok && out == first);
+	ok = adapter.try_pop(out);
+	assert(ok && out == second);
+	ok = adapter.try_pop(out);
+	assert(!ok && out == second);
+	(void)ok;
+	(void)first;
+	(void)second;
+}
+
+/*
+ * Deletes from both ends of a list holding 1, 2 and 3, then from the
+ * emptied list.
+ */
+template <typename List>
+void check_try_del_ends(List& list)
+{
+	int out = -1;
+	bool ok = list.try_del_first(out);
+	assert(ok && out == 1);
+	ok = list.try_del_last(out);
+	assert(ok && out == 3);
+	ok = list.try_del_last(out);
+	assert(ok && out == 2);
+	ok = list.try_del_first(out);
+	assert(!ok);
+	ok = list.try_del_last(out);
+	assert(!ok && out == 2);
+	(void)ok;
+}
+
+template <typename List>
+void check_try_del()
+{
+	List list;
+	int out = -1;
+	bool ok = list.try_del_first(out);
+	assert(!ok && out == -1);
+	list.add_last(1);
+	list.add_last(2);
+	list.add_last(3);
+	check_try_del_ends(list);
+	(void)ok;
+}
+
+template <typename Deque>
+void check_try_del_and_peek()
+{
+	Deque deque;
+	int out = -1;
+	bool ok = deque.try_peek_first(out);
+	assert(!ok);
+	ok = deque.try_peek_last(out);
+	assert(!ok && out == -1);
+	deque.add_last(1);
+	deque.add_last(2);
+	deque.add_last(3);
+	ok = deque.try_peek_first(out);
+	assert(ok && out == 1);
+	ok = deque.try_peek_last(out);
+	assert(ok && out == 3);
+	check_try_del_ends(deque);
+	ok = deque.try_peek_first(out);
+	assert(!ok && out == 3);
+	(void)ok;
+}
+
+#endif // DATA_STRUCTURES_TESTS_TRY_OPS_H